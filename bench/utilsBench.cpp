@@ -0,0 +1,549 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Micro benchmarks of the library.
+//
+// Usage: utilsBench [-sizes 1024,1048576] [-repetitions 10] [-filter name] [-json results.json]
+//                   [-baseline baseline.json] [-threshold 10]
+//
+// Every benchmark is run for every size, and the fastest repetition is reported in nanoseconds per operation.
+// With -baseline, the results are compared with a previous JSON output, and the program exits with status 1
+// if any benchmark is slower than the baseline by more than the threshold, in percent.
+
+#include <Accumulator.hpp>
+#include <ArgumentList.hpp>
+#include <Arena.hpp>
+#include <Bitmap.hpp>
+#include <ByteSwap.hpp>
+#include <Compare.hpp>
+#include <SourceCache.hpp>
+#include <Statistics.hpp>
+#include <TaskPool.hpp>
+#include <Timer.hpp>
+#include <Unpack.hpp>
+#include <utils.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+
+// Results are accumulated here, so that the compiler cannot remove the benchmarked code
+volatile std::uint64_t sink = 0;
+
+// A repetition runs the benchmarked code, between start and stop of the timer, and returns the number of operations performed
+using Repetition = std::function<std::uint64_t(isa::utils::Timer & timer)>;
+
+struct Benchmark {
+  std::string name;
+  // Prepares the input for a given size, and returns the repetition
+  std::function<Repetition(std::uint64_t size)> setup;
+};
+
+struct Result {
+  std::string name;
+  std::uint64_t size;
+  std::uint64_t nrOperations;
+  double minimum;
+  double mean;
+  double standardDeviation;
+};
+
+std::vector<Benchmark> getBenchmarks() {
+  std::vector<Benchmark> benchmarks;
+
+  benchmarks.push_back({"replace", [](const std::uint64_t size) -> Repetition {
+    std::string source;
+
+    while ( source.size() < size ) {
+      source.append("float <%NAME%>_value = input[<%NAME%>]; ");
+    }
+    return [source](isa::utils::Timer & timer) -> std::uint64_t {
+      std::string input(source);
+
+      timer.start();
+      std::string * output = isa::utils::replace(&input, "<%NAME%>", "variable");
+      timer.stop();
+      sink += output->size();
+      delete output;
+      return source.size();
+    };
+  }});
+  benchmarks.push_back({"replaceInPlace", [](const std::uint64_t size) -> Repetition {
+    std::string source;
+    auto output = std::make_shared<std::string>();
+
+    while ( source.size() < size ) {
+      source.append("float <%NAME%>_value = input[<%NAME%>]; ");
+    }
+    return [source, output](isa::utils::Timer & timer) -> std::uint64_t {
+      timer.start();
+      isa::utils::replace(source, "<%NAME%>", "variable", *output);
+      timer.stop();
+      sink += output->size();
+      return source.size();
+    };
+  }});
+  benchmarks.push_back({"render", [](const std::uint64_t size) -> Repetition {
+    std::string source;
+
+    while ( source.size() < size ) {
+      source.append("float <%NAME%>_value = input[<%NAME%> * <%STRIDE%>]; ");
+    }
+    return [source](isa::utils::Timer & timer) -> std::uint64_t {
+      std::uint64_t total = 0;
+
+      timer.start();
+      for ( unsigned int configuration = 0; configuration < 64; configuration++ ) {
+        total += isa::utils::render(source, {{"<%NAME%>", "variable" + std::to_string(configuration)}, {"<%STRIDE%>", std::to_string(configuration % 8)}}).size();
+      }
+      timer.stop();
+      sink += total;
+      return 64;
+    };
+  }});
+  benchmarks.push_back({"SourceCache::get", [](const std::uint64_t size) -> Repetition {
+    auto source = std::make_shared<isa::utils::SourceTemplate>(std::string());
+    auto cache = std::make_shared<isa::utils::SourceCache>();
+    std::string content;
+
+    while ( content.size() < size ) {
+      content.append("float <%NAME%>_value = input[<%NAME%> * <%STRIDE%>]; ");
+    }
+    *source = isa::utils::SourceTemplate(content);
+    // The first repetition fills the cache, the following ones measure a warm tuning sweep
+    return [source, cache](isa::utils::Timer & timer) -> std::uint64_t {
+      std::uint64_t total = 0;
+
+      timer.start();
+      for ( unsigned int configuration = 0; configuration < 64; configuration++ ) {
+        total += cache->get(*source, {{"<%NAME%>", "variable" + std::to_string(configuration)}, {"<%STRIDE%>", std::to_string(configuration % 8)}})->size();
+      }
+      timer.stop();
+      sink += total;
+      return 64;
+    };
+  }});
+  benchmarks.push_back({"castToType", [](const std::uint64_t size) -> Repetition {
+    std::vector<std::string> values(size);
+
+    for ( std::uint64_t item = 0; item < size; item++ ) {
+      values.at(item) = std::to_string(item * 7);
+    }
+    return [values](isa::utils::Timer & timer) -> std::uint64_t {
+      std::uint64_t total = 0;
+
+      timer.start();
+      for ( const auto & value : values ) {
+        total += isa::utils::castToType<std::string, unsigned int>(value);
+      }
+      timer.stop();
+      sink += total;
+      return values.size();
+    };
+  }});
+  benchmarks.push_back({"ArgumentList", [](const std::uint64_t size) -> Repetition {
+    // The command line is limited to a realistic length
+    const std::uint64_t nrSwitches = (size < 256) ? size : 256;
+    std::vector<std::string> arguments;
+
+    arguments.emplace_back("utilsBench");
+    for ( std::uint64_t option = 0; option < nrSwitches; option++ ) {
+      arguments.push_back("-option" + std::to_string(option));
+      arguments.push_back(std::to_string(option));
+    }
+    return [arguments, nrSwitches](isa::utils::Timer & timer) -> std::uint64_t {
+      std::vector<char *> argv;
+      std::uint64_t total = 0;
+
+      for ( const auto & argument : arguments ) {
+        argv.push_back(const_cast<char *>(argument.c_str()));
+      }
+      timer.start();
+      isa::utils::ArgumentList list(static_cast<int>(argv.size()), argv.data());
+      // Looked up from the last one, the worst case for the linear search
+      for ( std::uint64_t option = nrSwitches; option > 0; option-- ) {
+        total += list.getSwitchArgument<unsigned int>("-option" + std::to_string(option - 1));
+      }
+      timer.stop();
+      sink += total;
+      return nrSwitches;
+    };
+  }});
+  benchmarks.push_back({"Statistics::addElement", [](const std::uint64_t size) -> Repetition {
+    return [size](isa::utils::Timer & timer) -> std::uint64_t {
+      isa::utils::Statistics<double> statistics;
+
+      timer.start();
+      for ( std::uint64_t item = 0; item < size; item++ ) {
+        statistics.addElement(static_cast<double>(item % 1000) + 1.0);
+      }
+      timer.stop();
+      sink += static_cast<std::uint64_t>(statistics.getMean());
+      return size;
+    };
+  }});
+  benchmarks.push_back({"Accumulator::addElement", [](const std::uint64_t size) -> Repetition {
+    return [size](isa::utils::Timer & timer) -> std::uint64_t {
+      // The features used by Timer
+      isa::utils::Accumulator<double, isa::utils::Accumulate::Variance | isa::utils::Accumulate::MinMax> accumulator;
+
+      timer.start();
+      for ( std::uint64_t item = 0; item < size; item++ ) {
+        accumulator.addElement(static_cast<double>(item % 1000) + 1.0);
+      }
+      timer.stop();
+      sink += static_cast<std::uint64_t>(accumulator.getMean());
+      return size;
+    };
+  }});
+  benchmarks.push_back({"Accumulator::addElement exact", [](const std::uint64_t size) -> Repetition {
+    return [size](isa::utils::Timer & timer) -> std::uint64_t {
+      isa::utils::Accumulator<std::int32_t, isa::utils::Accumulate::Variance | isa::utils::Accumulate::Exact> accumulator;
+
+      timer.start();
+      for ( std::uint64_t item = 0; item < size; item++ ) {
+        accumulator.addElement(static_cast<std::int32_t>(item % 1000) + 1);
+      }
+      timer.stop();
+      sink += static_cast<std::uint64_t>(accumulator.getVariance());
+      return size;
+    };
+  }});
+  benchmarks.push_back({"Timer::start/stop", [](const std::uint64_t size) -> Repetition {
+    return [size](isa::utils::Timer & timer) -> std::uint64_t {
+      isa::utils::Timer measured;
+
+      timer.start();
+      for ( std::uint64_t item = 0; item < size; item++ ) {
+        measured.start();
+        measured.stop();
+      }
+      timer.stop();
+      sink += measured.getNrRuns();
+      return size;
+    };
+  }});
+  benchmarks.push_back({"bigEndianToLittleEndian", [](const std::uint64_t size) -> Repetition {
+    auto values = std::make_shared<std::vector<std::uint32_t>>(size);
+
+    for ( std::uint64_t item = 0; item < size; item++ ) {
+      values->at(item) = static_cast<std::uint32_t>(item * 2654435761u);
+    }
+    return [values](isa::utils::Timer & timer) -> std::uint64_t {
+      timer.start();
+      for ( auto & value : *values ) {
+        isa::utils::bigEndianToLittleEndian(&value);
+      }
+      timer.stop();
+      sink += values->front();
+      return values->size();
+    };
+  }});
+  benchmarks.push_back({"byteSwap<uint32_t>", [](const std::uint64_t size) -> Repetition {
+    auto values = std::make_shared<std::vector<std::uint32_t>>(size, 0x01020304u);
+
+    return [values](isa::utils::Timer & timer) -> std::uint64_t {
+      timer.start();
+      isa::utils::byteSwap(values->data(), values->size());
+      timer.stop();
+      sink += values->front();
+      return values->size();
+    };
+  }});
+  benchmarks.push_back({"unpack<4>(float)", [](const std::uint64_t size) -> Repetition {
+    auto packed = std::make_shared<std::vector<std::uint8_t>>((size + 1) / 2, 0x5a);
+    auto samples = std::make_shared<std::vector<float>>(size);
+
+    return [packed, samples](isa::utils::Timer & timer) -> std::uint64_t {
+      timer.start();
+      isa::utils::unpack<4>(packed->data(), samples->data(), samples->size(), true, 0.5f, 0.0f);
+      timer.stop();
+      sink += static_cast<std::uint64_t>(samples->back());
+      return samples->size();
+    };
+  }});
+  benchmarks.push_back({"pack<4>", [](const std::uint64_t size) -> Repetition {
+    auto samples = std::make_shared<std::vector<std::int8_t>>(size, 5);
+    auto packed = std::make_shared<std::vector<std::uint8_t>>((size + 1) / 2);
+
+    return [samples, packed](isa::utils::Timer & timer) -> std::uint64_t {
+      timer.start();
+      isa::utils::pack<4>(samples->data(), packed->data(), samples->size());
+      timer.stop();
+      sink += packed->front();
+      return samples->size();
+    };
+  }});
+  benchmarks.push_back({"Bitmap::count", [](const std::uint64_t size) -> Repetition {
+    auto bitmap = std::make_shared<isa::utils::Bitmap>(size);
+
+    for ( std::uint64_t bit = 0; bit < size; bit += 3 ) {
+      bitmap->set(bit);
+    }
+    return [bitmap](isa::utils::Timer & timer) -> std::uint64_t {
+      timer.start();
+      sink += bitmap->count();
+      timer.stop();
+      return bitmap->getNrBits();
+    };
+  }});
+  benchmarks.push_back({"applyMask", [](const std::uint64_t size) -> Repetition {
+    auto mask = std::make_shared<isa::utils::Bitmap>(size);
+    auto data = std::make_shared<std::vector<float>>(size, 1.0f);
+
+    for ( std::uint64_t bit = 0; bit < size; bit += 97 ) {
+      mask->set(bit);
+    }
+    return [mask, data](isa::utils::Timer & timer) -> std::uint64_t {
+      timer.start();
+      isa::utils::applyMask(*mask, data->data());
+      timer.stop();
+      sink += static_cast<std::uint64_t>(data->back());
+      return data->size();
+    };
+  }});
+  benchmarks.push_back({"compare<float>", [](const std::uint64_t size) -> Repetition {
+    auto result = std::make_shared<std::vector<float>>(size, 1.0f);
+    auto expected = std::make_shared<std::vector<float>>(size, 1.0f);
+
+    return [result, expected](isa::utils::Timer & timer) -> std::uint64_t {
+      timer.start();
+      isa::utils::ComparisonResult comparison = isa::utils::compare(result->data(), expected->data(), result->size());
+      timer.stop();
+      sink += comparison.nrMismatches;
+      return result->size();
+    };
+  }});
+  benchmarks.push_back({"TaskPool::parallelFor", [](const std::uint64_t size) -> Repetition {
+    auto pool = std::make_shared<isa::utils::TaskPool>();
+    auto data = std::make_shared<std::vector<float>>(size, 1.0f);
+
+    return [pool, data](isa::utils::Timer & timer) -> std::uint64_t {
+      timer.start();
+      pool->parallelFor(0, data->size(), [&data](std::size_t first, std::size_t last) {
+        for ( std::size_t item = first; item < last; item++ ) {
+          data->at(item) = (data->at(item) * 0.5f) + 1.0f;
+        }
+      });
+      timer.stop();
+      sink += static_cast<std::uint64_t>(data->back());
+      return data->size();
+    };
+  }});
+  benchmarks.push_back({"Arena::allocate", [](const std::uint64_t size) -> Repetition {
+    auto arena = std::make_shared<isa::utils::Arena>();
+
+    return [arena, size](isa::utils::Timer & timer) -> std::uint64_t {
+      arena->reset();
+      timer.start();
+      for ( std::uint64_t item = 0; item < size; item++ ) {
+        sink += reinterpret_cast<std::uintptr_t>(arena->allocate(24)) & 1;
+      }
+      timer.stop();
+      return size;
+    };
+  }});
+
+  return benchmarks;
+}
+
+std::vector<std::uint64_t> parseSizes(const std::string & list) {
+  std::vector<std::uint64_t> sizes;
+  std::stringstream stream(list);
+  std::string item;
+
+  while ( std::getline(stream, item, ',') ) {
+    if ( !item.empty() ) {
+      sizes.push_back(isa::utils::castToType<std::string, std::uint64_t>(item));
+    }
+  }
+
+  return sizes;
+}
+
+template<typename T> T getOptionalArgument(isa::utils::ArgumentList & arguments, const std::string & option, const T & defaultValue) {
+  try {
+    return arguments.getSwitchArgument<T>(option);
+  } catch ( const isa::utils::SwitchNotFound & ) {
+    return defaultValue;
+  } catch ( const isa::utils::EmptyCommandLine & ) {
+    return defaultValue;
+  }
+}
+
+std::string getKey(const std::string & name, const std::uint64_t size) {
+  return name + "/" + std::to_string(size);
+}
+
+double getNanosecondsPerOperation(const Result & result) {
+  return (result.minimum * 1.0e+09) / result.nrOperations;
+}
+
+void writeJSON(std::ostream & output, const std::vector<Result> & results) {
+  output << std::setprecision(9);
+  output << "{\n  \"benchmarks\": [\n";
+  // One benchmark per line, as expected by readBaseline()
+  for ( std::size_t item = 0; item < results.size(); item++ ) {
+    const Result & result = results.at(item);
+
+    output << "    {\"name\": \"" << result.name << "\", \"size\": " << result.size << ", \"operations\": " << result.nrOperations;
+    output << ", \"minimum\": " << result.minimum << ", \"mean\": " << result.mean << ", \"standardDeviation\": " << result.standardDeviation;
+    output << ", \"nsPerOperation\": " << getNanosecondsPerOperation(result) << "}" << ((item + 1 < results.size()) ? "," : "") << "\n";
+  }
+  output << "  ]\n}\n";
+}
+
+std::string getField(const std::string & line, const std::string & field) {
+  const std::string key = "\"" + field + "\": ";
+  std::size_t begin = line.find(key);
+
+  if ( begin == std::string::npos ) {
+    return "";
+  }
+  begin += key.size();
+  if ( line.at(begin) == '"' ) {
+    begin++;
+    return line.substr(begin, line.find('"', begin) - begin);
+  }
+
+  return line.substr(begin, line.find_first_of(",}", begin) - begin);
+}
+
+std::map<std::string, double> readBaseline(const std::string & path) {
+  std::map<std::string, double> baseline;
+  std::ifstream input(path);
+  std::string line;
+
+  if ( !input ) {
+    throw std::runtime_error("ERROR: impossible to open the baseline \"" + path + "\"");
+  }
+  while ( std::getline(input, line) ) {
+    std::string name = getField(line, "name");
+
+    if ( name.empty() ) {
+      continue;
+    }
+    baseline[getKey(name, isa::utils::castToType<std::string, std::uint64_t>(getField(line, "size")))] = isa::utils::castToType<std::string, double>(getField(line, "nsPerOperation"));
+  }
+
+  return baseline;
+}
+
+} // (anonymous)
+
+int main(int argc, char * argv[]) {
+  isa::utils::ArgumentList arguments(argc, argv);
+  std::vector<std::uint64_t> sizes;
+  unsigned int nrRepetitions = 0;
+  std::string filter;
+  std::string jsonPath;
+  std::string baselinePath;
+  double threshold = 0.0;
+
+  try {
+    sizes = parseSizes(getOptionalArgument<std::string>(arguments, "-sizes", "1024,1048576"));
+    nrRepetitions = getOptionalArgument<unsigned int>(arguments, "-repetitions", 10);
+    filter = getOptionalArgument<std::string>(arguments, "-filter", "");
+    jsonPath = getOptionalArgument<std::string>(arguments, "-json", "");
+    baselinePath = getOptionalArgument<std::string>(arguments, "-baseline", "");
+    threshold = getOptionalArgument<double>(arguments, "-threshold", 10.0);
+  } catch ( const std::exception & err ) {
+    std::cerr << err.what() << std::endl;
+    return 2;
+  }
+  if ( sizes.empty() || nrRepetitions == 0 ) {
+    std::cerr << "Usage: " << arguments.getName() << " [-sizes 1024,1048576] [-repetitions 10] [-filter name] [-json results.json] [-baseline baseline.json] [-threshold 10]" << std::endl;
+    return 2;
+  }
+
+  std::vector<Result> results;
+
+  std::cout << std::fixed << std::setprecision(3);
+  for ( const auto & benchmark : getBenchmarks() ) {
+    if ( !filter.empty() && benchmark.name.find(filter) == std::string::npos ) {
+      continue;
+    }
+    for ( auto size : sizes ) {
+      Repetition repetition = benchmark.setup(size);
+      isa::utils::Timer timer;
+      Result result;
+
+      // The first repetition warms up caches and allocations, and is not measured
+      {
+        isa::utils::Timer warmup;
+        repetition(warmup);
+      }
+      for ( unsigned int item = 0; item < nrRepetitions; item++ ) {
+        result.nrOperations = repetition(timer);
+      }
+      result.name = benchmark.name;
+      result.size = size;
+      result.minimum = timer.getMinTime();
+      result.mean = timer.getAverageTime();
+      result.standardDeviation = timer.getStandardDeviation();
+      results.push_back(result);
+      std::cout << std::setw(28) << std::left << benchmark.name << std::setw(12) << std::right << size;
+      std::cout << std::setw(14) << getNanosecondsPerOperation(result) << " ns/op" << std::endl;
+    }
+  }
+  if ( !jsonPath.empty() ) {
+    std::ofstream output(jsonPath);
+
+    writeJSON(output, results);
+    if ( !output ) {
+      std::cerr << "ERROR: impossible to write \"" << jsonPath << "\"" << std::endl;
+      return 2;
+    }
+  }
+  if ( baselinePath.empty() ) {
+    return 0;
+  }
+
+  std::map<std::string, double> baseline;
+  unsigned int nrRegressions = 0;
+
+  try {
+    baseline = readBaseline(baselinePath);
+  } catch ( const std::exception & err ) {
+    std::cerr << err.what() << std::endl;
+    return 2;
+  }
+  for ( const auto & result : results ) {
+    auto reference = baseline.find(getKey(result.name, result.size));
+
+    if ( reference == baseline.end() || reference->second <= 0.0 ) {
+      continue;
+    }
+    double change = ((getNanosecondsPerOperation(result) / reference->second) - 1.0) * 100.0;
+
+    if ( change > threshold ) {
+      nrRegressions++;
+      std::cout << "REGRESSION: " << getKey(result.name, result.size) << " is " << change << "% slower than the baseline (" << reference->second << " ns/op)" << std::endl;
+    }
+  }
+  std::cout << nrRegressions << " regressions, threshold " << threshold << "%" << std::endl;
+
+  return (nrRegressions > 0) ? 1 : 0;
+}
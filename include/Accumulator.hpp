@@ -0,0 +1,504 @@
+///
+/// \file Accumulator.hpp
+/// \brief
+///
+/// Accumulator class, running statistics that only compute the selected features.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <type_traits>
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \enum Accumulate
+/// \brief Features of an Accumulator, combined with operator|.
+///
+enum class Accumulate : unsigned int {
+  /// Number of samples
+  Count = 1u << 0,
+  /// Sum of the samples
+  Sum = 1u << 1,
+  /// Mean, implies Count
+  Mean = 1u << 2,
+  /// Variance, standard deviation and coefficient of variation, implies Mean
+  Variance = 1u << 3,
+  /// Harmonic mean, implies Count
+  HarmonicMean = 1u << 4,
+  /// Root mean square, implies Count
+  RootMeanSquare = 1u << 5,
+  /// Minimum and maximum
+  MinMax = 1u << 6,
+  /// Exact integer sums for integral samples, without per-sample divisions
+  Exact = 1u << 7,
+  /// All the features of Statistics
+  All = (1u << 7) - 1
+};
+
+///
+/// \fn constexpr Accumulate operator|(Accumulate first, Accumulate second)
+/// \brief Combine two sets of features.
+///
+/// @param first The first set of features
+/// @param second The second set of features
+/// @return The union of the two sets
+///
+constexpr Accumulate operator|(Accumulate first, Accumulate second);
+///
+/// \fn constexpr bool has(Accumulate features, Accumulate feature)
+/// \brief Check if a set of features contains a feature, after adding the features it implies.
+///
+/// @param features The set of features
+/// @param feature The feature to look for
+/// @return True if the feature is in the set, false otherwise
+///
+constexpr bool has(Accumulate features, Accumulate feature);
+
+// Base classes of Accumulator, one per feature, empty when the feature is disabled
+
+template<bool Enabled> class AccumulatorCount {
+protected:
+  inline void add() {}
+  inline void reset() {}
+  inline std::uint64_t count() const {
+    return 0;
+  }
+};
+
+template<> class AccumulatorCount<true> {
+protected:
+  inline void add() {
+    nrElements++;
+  }
+  inline void reset() {
+    nrElements = 0;
+  }
+  inline std::uint64_t count() const {
+    return nrElements;
+  }
+
+private:
+  std::uint64_t nrElements = 0;
+};
+
+template<typename T, bool Enabled, bool Exact> class AccumulatorSum {
+protected:
+  inline void add(T) {}
+  inline void reset() {}
+};
+
+template<typename T> class AccumulatorSum<T, true, false> {
+protected:
+  inline void add(const T element) {
+    sum += static_cast<double>(element);
+  }
+  inline void reset() {
+    sum = 0.0;
+  }
+
+  double sum = 0.0;
+};
+
+template<typename T> class AccumulatorSum<T, true, true> {
+protected:
+  inline void add(const T element) {
+    sum += element;
+  }
+  inline void reset() {
+    sum = 0;
+  }
+
+  typename std::conditional<std::is_signed<T>::value, __int128, unsigned __int128>::type sum = 0;
+};
+
+// Welford's algorithm, the same used by Statistics
+template<bool HasMean, bool HasVariance> class AccumulatorMoments {
+protected:
+  template<typename T> inline void add(T, std::uint64_t) {}
+  inline void reset() {}
+};
+
+template<> class AccumulatorMoments<true, false> {
+protected:
+  template<typename T> inline void add(const T element, const std::uint64_t nrElements) {
+    mean += (static_cast<double>(element) - mean) / nrElements;
+  }
+  inline void reset() {
+    mean = 0.0;
+  }
+
+  double mean = 0.0;
+};
+
+template<> class AccumulatorMoments<true, true> {
+protected:
+  template<typename T> inline void add(const T element, const std::uint64_t nrElements) {
+    double oldMean = mean;
+
+    mean += (static_cast<double>(element) - oldMean) / nrElements;
+    variance += (static_cast<double>(element) - oldMean) * (static_cast<double>(element) - mean);
+  }
+  inline void reset() {
+    mean = 0.0;
+    variance = 0.0;
+  }
+
+  double mean = 0.0;
+  double variance = 0.0;
+};
+
+template<bool Enabled> class AccumulatorHarmonicMean {
+protected:
+  template<typename T> inline void add(T) {}
+  inline void reset() {}
+};
+
+template<> class AccumulatorHarmonicMean<true> {
+protected:
+  template<typename T> inline void add(const T element) {
+    harmonicMean += 1.0 / element;
+  }
+  inline void reset() {
+    harmonicMean = 0.0;
+  }
+
+  double harmonicMean = 0.0;
+};
+
+template<typename T, bool Enabled, bool Exact> class AccumulatorSquares {
+protected:
+  inline void add(T) {}
+  inline void reset() {}
+};
+
+template<typename T> class AccumulatorSquares<T, true, false> {
+protected:
+  inline void add(const T element) {
+    squares += static_cast<double>(element) * static_cast<double>(element);
+  }
+  inline void reset() {
+    squares = 0.0;
+  }
+
+  double squares = 0.0;
+};
+
+template<typename T> class AccumulatorSquares<T, true, true> {
+protected:
+  static_assert(sizeof(T) <= 4, "Exact sums of squares are only defined for samples of up to 32 bits.");
+
+  inline void add(const T element) {
+    // The square of a 32 bits integer fits in 64 bits
+    typename std::conditional<std::is_signed<T>::value, std::int64_t, std::uint64_t>::type value = element;
+
+    squares += static_cast<std::uint64_t>(value * value);
+  }
+  inline void reset() {
+    squares = 0;
+  }
+
+  unsigned __int128 squares = 0;
+};
+
+template<typename T, bool Enabled> class AccumulatorMinMax {
+protected:
+  inline void add(T) {}
+  inline void reset() {}
+};
+
+template<typename T> class AccumulatorMinMax<T, true> {
+protected:
+  inline void add(const T element) {
+    min = (element < min) ? element : min;
+    max = (element > max) ? element : max;
+  }
+  inline void reset() {
+    min = std::numeric_limits<T>::max();
+    max = std::numeric_limits<T>::lowest();
+  }
+
+  T min = std::numeric_limits<T>::max();
+  T max = std::numeric_limits<T>::lowest();
+};
+
+///
+/// \class Accumulator
+/// \brief Running statistics of discrete samples, computing only the features selected at compile time.
+///
+/// Every feature is stored in its own base class, that is empty when the feature is not selected; unused features take no
+/// space in the object, and their updates are empty functions removed by the compiler. The results are the same as the ones
+/// of Statistics, that computes all features.
+///
+/// With Accumulate::Exact, sums and sums of squares of integral samples are kept in 128 bits integers; mean, variance and root
+/// mean square are computed from them only when retrieved, so there is no division per sample and no error accumulated over
+/// the samples, only the final result is rounded.
+///
+template<typename T, Accumulate Features> class Accumulator :
+  private AccumulatorCount<has(Features, Accumulate::Count)>,
+  private AccumulatorSum<T, has(Features, Accumulate::Sum) || (has(Features, Accumulate::Exact) && has(Features, Accumulate::Mean)), has(Features, Accumulate::Exact)>,
+  private AccumulatorMoments<has(Features, Accumulate::Mean) && !has(Features, Accumulate::Exact), has(Features, Accumulate::Variance) && !has(Features, Accumulate::Exact)>,
+  private AccumulatorHarmonicMean<has(Features, Accumulate::HarmonicMean)>,
+  private AccumulatorSquares<T, has(Features, Accumulate::RootMeanSquare) || (has(Features, Accumulate::Exact) && has(Features, Accumulate::Variance)), has(Features, Accumulate::Exact)>,
+  private AccumulatorMinMax<T, has(Features, Accumulate::MinMax)> {
+  static_assert(!has(Features, Accumulate::Exact) || std::is_integral<T>::value, "Exact accumulation is only defined for integral types.");
+
+  using CountBase = AccumulatorCount<has(Features, Accumulate::Count)>;
+  using SumBase = AccumulatorSum<T, has(Features, Accumulate::Sum) || (has(Features, Accumulate::Exact) && has(Features, Accumulate::Mean)), has(Features, Accumulate::Exact)>;
+  using MomentsBase = AccumulatorMoments<has(Features, Accumulate::Mean) && !has(Features, Accumulate::Exact), has(Features, Accumulate::Variance) && !has(Features, Accumulate::Exact)>;
+  using HarmonicMeanBase = AccumulatorHarmonicMean<has(Features, Accumulate::HarmonicMean)>;
+  using SquaresBase = AccumulatorSquares<T, has(Features, Accumulate::RootMeanSquare) || (has(Features, Accumulate::Exact) && has(Features, Accumulate::Variance)), has(Features, Accumulate::Exact)>;
+  using MinMaxBase = AccumulatorMinMax<T, has(Features, Accumulate::MinMax)>;
+
+public:
+  /// Type of the exact sum of the samples
+  using ExactSum = typename std::conditional<std::is_signed<T>::value, __int128, unsigned __int128>::type;
+
+  ///
+  /// \fn inline void addElement(T element)
+  /// \brief Add a new sample to the running statistics.
+  ///
+  /// @param element The new sample to add to the running statistics
+  ///
+  inline void addElement(T element);
+  ///
+  /// \fn inline void reset()
+  /// \brief Reset the internal state of the running statistics.
+  ///
+  inline void reset();
+
+  ///
+  /// \fn inline std::uint64_t getNrElements() const
+  /// \brief Retrieve the number of samples added to the running statistics. Requires Accumulate::Count.
+  ///
+  /// @return The number of previously added samples
+  ///
+  inline std::uint64_t getNrElements() const;
+  ///
+  /// \fn inline double getSum() const
+  /// \brief Retrieve the sum of the added samples. Requires Accumulate::Sum.
+  ///
+  /// @return The sum of the previously added samples
+  ///
+  inline double getSum() const;
+  ///
+  /// \fn inline ExactSum getExactSum() const
+  /// \brief Retrieve the exact sum of the added samples. Requires Accumulate::Sum and Accumulate::Exact.
+  ///
+  /// @return The sum of the previously added samples, as a 128 bits integer
+  ///
+  inline ExactSum getExactSum() const;
+  ///
+  /// \fn inline double getMean() const
+  /// \brief Retrieve the mean of the added samples. Requires Accumulate::Mean.
+  ///
+  /// @return The mean of the previously added samples
+  ///
+  inline double getMean() const;
+  ///
+  /// \fn inline double getHarmonicMean() const
+  /// \brief Retrieve the harmonic mean of the added samples. Requires Accumulate::HarmonicMean.
+  ///
+  /// @return The harmonic mean of the previously added samples
+  ///
+  inline double getHarmonicMean() const;
+  ///
+  /// \fn inline double getVariance() const
+  /// \brief Retrieve the variance of the added samples. Requires Accumulate::Variance.
+  ///
+  /// @return The variance of the previously added samples
+  ///
+  inline double getVariance() const;
+  ///
+  /// \fn inline double getStandardDeviation() const
+  /// \brief Retrieve the standard deviation of the added samples. Requires Accumulate::Variance.
+  ///
+  /// @return The standard deviation of the previously added samples
+  ///
+  inline double getStandardDeviation() const;
+  ///
+  /// \fn inline double getCoefficientOfVariation() const
+  /// \brief Retrieve the coefficient of variation of the added samples. Requires Accumulate::Variance.
+  ///
+  /// The coefficient of variation is defined as the standard deviation divided by the mean.
+  ///
+  /// @return The coefficient of variation of the previously added samples
+  ///
+  inline double getCoefficientOfVariation() const;
+  ///
+  /// \fn inline double getRootMeanSquare() const
+  /// \brief Retrieve the root mean square of the added samples. Requires Accumulate::RootMeanSquare.
+  ///
+  /// @return The root mean square of the previously added samples
+  ///
+  inline double getRootMeanSquare() const;
+  ///
+  /// \fn inline T getMin() const
+  /// \brief Retrieve the minimum of the added samples. Requires Accumulate::MinMax.
+  ///
+  /// @return The minimum of the previously added samples
+  ///
+  inline T getMin() const;
+  ///
+  /// \fn inline T getMax() const
+  /// \brief Retrieve the maximum of the added samples. Requires Accumulate::MinMax.
+  ///
+  /// @return The maximum of the previously added samples
+  ///
+  inline T getMax() const;
+
+private:
+  // Exact and floating point versions, selected at compile time
+  inline double getMean(std::true_type) const;
+  inline double getMean(std::false_type) const;
+  inline double getVariance(std::true_type) const;
+  inline double getVariance(std::false_type) const;
+};
+
+
+constexpr Accumulate operator|(const Accumulate first, const Accumulate second) {
+  return static_cast<Accumulate>(static_cast<unsigned int>(first) | static_cast<unsigned int>(second));
+}
+
+constexpr bool has(const Accumulate features, const Accumulate feature) {
+  // Variance implies Mean, and all features divided by the number of samples imply Count
+  return (static_cast<unsigned int>(features) & static_cast<unsigned int>(feature)) != 0
+    || (feature == Accumulate::Mean && has(features, Accumulate::Variance))
+    || (feature == Accumulate::Count && (has(features, Accumulate::Mean) || has(features, Accumulate::HarmonicMean) || has(features, Accumulate::RootMeanSquare)));
+}
+
+template<typename T, Accumulate Features> inline void Accumulator<T, Features>::addElement(const T element) {
+  CountBase::add();
+  SumBase::add(element);
+  MomentsBase::add(element, CountBase::count());
+  HarmonicMeanBase::add(element);
+  SquaresBase::add(element);
+  MinMaxBase::add(element);
+}
+
+template<typename T, Accumulate Features> inline void Accumulator<T, Features>::reset() {
+  CountBase::reset();
+  SumBase::reset();
+  MomentsBase::reset();
+  HarmonicMeanBase::reset();
+  SquaresBase::reset();
+  MinMaxBase::reset();
+}
+
+template<typename T, Accumulate Features> inline std::uint64_t Accumulator<T, Features>::getNrElements() const {
+  static_assert(has(Features, Accumulate::Count), "Accumulate::Count is not enabled.");
+  return CountBase::count();
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getSum() const {
+  static_assert(has(Features, Accumulate::Sum), "Accumulate::Sum is not enabled.");
+  return static_cast<double>(SumBase::sum);
+}
+
+template<typename T, Accumulate Features> inline typename Accumulator<T, Features>::ExactSum Accumulator<T, Features>::getExactSum() const {
+  static_assert(has(Features, Accumulate::Sum) && has(Features, Accumulate::Exact), "Accumulate::Sum and Accumulate::Exact are not enabled.");
+  return SumBase::sum;
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getMean() const {
+  static_assert(has(Features, Accumulate::Mean), "Accumulate::Mean is not enabled.");
+  return getMean(std::integral_constant<bool, has(Features, Accumulate::Exact)>());
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getHarmonicMean() const {
+  static_assert(has(Features, Accumulate::HarmonicMean), "Accumulate::HarmonicMean is not enabled.");
+  if ( CountBase::count() > 0 ) {
+    return CountBase::count() / HarmonicMeanBase::harmonicMean;
+  } else {
+    return 0.0;
+  }
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getVariance() const {
+  static_assert(has(Features, Accumulate::Variance), "Accumulate::Variance is not enabled.");
+  if ( CountBase::count() < 2 ) {
+    return 0.0;
+  }
+  return getVariance(std::integral_constant<bool, has(Features, Accumulate::Exact)>());
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getStandardDeviation() const {
+  return std::sqrt(this->getVariance());
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getCoefficientOfVariation() const {
+  return this->getStandardDeviation() / this->getMean();
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getRootMeanSquare() const {
+  static_assert(has(Features, Accumulate::RootMeanSquare), "Accumulate::RootMeanSquare is not enabled.");
+  return std::sqrt(static_cast<double>(static_cast<long double>(SquaresBase::squares) / CountBase::count()));
+}
+
+template<typename T, Accumulate Features> inline T Accumulator<T, Features>::getMin() const {
+  static_assert(has(Features, Accumulate::MinMax), "Accumulate::MinMax is not enabled.");
+  return MinMaxBase::min;
+}
+
+template<typename T, Accumulate Features> inline T Accumulator<T, Features>::getMax() const {
+  static_assert(has(Features, Accumulate::MinMax), "Accumulate::MinMax is not enabled.");
+  return MinMaxBase::max;
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getMean(std::true_type) const {
+  const ExactSum nrElements = static_cast<ExactSum>(CountBase::count());
+
+  if ( nrElements == 0 ) {
+    return 0.0;
+  }
+  // Integer quotient and remainder are exact, the sum itself may not fit in a long double
+  const ExactSum quotient = SumBase::sum / nrElements;
+  const ExactSum remainder = SumBase::sum % nrElements;
+
+  return static_cast<double>(static_cast<long double>(quotient) + (static_cast<long double>(remainder) / CountBase::count()));
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getMean(std::false_type) const {
+  return MomentsBase::mean;
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getVariance(std::true_type) const {
+  // The sum of the squared deviations is squares - sum^2 / n; with sum = (q * n) + r, this is squares - (q * q * n) - (2 * q * r)
+  // computed exactly in integers, minus r^2 / n, with |r| < n, in floating point. Computing sum^2 / n in floating point instead
+  // cancels all significant digits when the mean is large compared with the spread. The integer part is computed modulo 2^128,
+  // that is exact because the result is non-negative and not larger than squares.
+  using Wide = unsigned __int128;
+  const ExactSum nrElements = static_cast<ExactSum>(CountBase::count());
+  const ExactSum quotient = SumBase::sum / nrElements;
+  const ExactSum remainder = SumBase::sum % nrElements;
+  const Wide integral = static_cast<Wide>(SquaresBase::squares) - (static_cast<Wide>(quotient) * static_cast<Wide>(quotient) * static_cast<Wide>(nrElements)) - (2 * static_cast<Wide>(quotient) * static_cast<Wide>(remainder));
+  const long double deviations = static_cast<long double>(integral) - ((static_cast<long double>(remainder) * static_cast<long double>(remainder)) / CountBase::count());
+
+  return static_cast<double>(deviations / (CountBase::count() - 1));
+}
+
+template<typename T, Accumulate Features> inline double Accumulator<T, Features>::getVariance(std::false_type) const {
+  return MomentsBase::variance / (CountBase::count() - 1);
+}
+
+} // utils
+} // isa
+
@@ -0,0 +1,253 @@
+///
+/// \file Allocations.hpp
+/// \brief
+///
+/// Allocation counters, scoped allocation accounting, and process memory usage.
+///
+/// The counters are only updated by the replacement global operator new and delete contained in the isa_utils_allocation_hooks library;
+/// linking that library is what enables the instrumentation.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <cstddef>
+#include <cinttypes>
+
+#include "Timer.hpp"
+#include "Statistics.hpp"
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \struct AllocationCounters
+/// \brief Allocation activity of the calling thread.
+///
+/// Memory freed by a different thread than the one that allocated it is accounted to the freeing thread, so live bytes can be negative.
+///
+struct AllocationCounters {
+  std::uint64_t nrAllocations = 0;
+  std::uint64_t nrDeallocations = 0;
+  std::uint64_t allocatedBytes = 0;
+  std::uint64_t freedBytes = 0;
+  std::int64_t liveBytes = 0;
+  std::int64_t peakLiveBytes = 0;
+};
+
+///
+/// \struct MemoryUsage
+/// \brief Memory usage of the whole process, as reported by the operating system.
+///
+struct MemoryUsage {
+  std::uint64_t residentBytes = 0;
+  std::uint64_t peakResidentBytes = 0;
+  std::uint64_t minorPageFaults = 0;
+  std::uint64_t majorPageFaults = 0;
+};
+
+///
+/// \fn bool allocationHooksInstalled()
+/// \brief Check if the replacement operator new and delete are linked in the running executable.
+///
+/// @return True if allocations are being counted, false otherwise
+///
+bool allocationHooksInstalled();
+///
+/// \fn void recordAllocation(std::size_t bytes)
+/// \brief Account for an allocation in the counters of the calling thread.
+///
+/// Called by the allocation hooks; custom allocators can call it to be accounted for as well.
+///
+/// @param bytes The size of the allocation
+///
+void recordAllocation(std::size_t bytes);
+///
+/// \fn void recordDeallocation(std::size_t bytes)
+/// \brief Account for a deallocation in the counters of the calling thread.
+///
+/// @param bytes The size of the freed memory
+///
+void recordDeallocation(std::size_t bytes);
+///
+/// \fn AllocationCounters getAllocationCounters()
+/// \brief Retrieve the counters of the calling thread, since the start of the thread.
+///
+/// @return The allocation counters of the calling thread
+///
+AllocationCounters getAllocationCounters();
+///
+/// \fn MemoryUsage getMemoryUsage()
+/// \brief Sample the resident set size and page faults of the process from /proc/self and getrusage().
+///
+/// @return The current memory usage of the process
+///
+MemoryUsage getMemoryUsage();
+
+///
+/// \class AllocationScope
+/// \brief Count the allocations performed by the calling thread during the lifetime of the object.
+///
+/// Scopes can be nested, but must be destroyed in reverse order of construction and on the same thread.
+///
+class AllocationScope {
+public:
+  ///
+  /// \fn AllocationScope()
+  /// \brief Constructor, opens the scope.
+  ///
+  AllocationScope();
+  ///
+  /// \fn ~AllocationScope()
+  /// \brief Destructor, closes the scope.
+  ///
+  ~AllocationScope();
+  AllocationScope(const AllocationScope &) = delete;
+  AllocationScope & operator=(const AllocationScope &) = delete;
+
+  ///
+  /// \fn AllocationCounters getCounters() const
+  /// \brief Retrieve the allocation activity since the scope was opened.
+  ///
+  /// The peak is relative to the live bytes when the scope was opened.
+  ///
+  /// @return The allocation counters of the scope
+  ///
+  AllocationCounters getCounters() const;
+
+private:
+  AllocationCounters begin;
+  std::int64_t outerPeak;
+};
+
+///
+/// \class AllocationProfiler
+/// \brief Timer that also counts the allocations performed in every timed interval.
+///
+/// Intervals are accounted to the thread calling start() and stop().
+///
+class AllocationProfiler {
+public:
+  ///
+  /// \fn AllocationProfiler()
+  /// \brief Constructor.
+  ///
+  AllocationProfiler();
+
+  ///
+  /// \fn void start()
+  /// \brief Start the timer and the allocation accounting.
+  ///
+  void start();
+  ///
+  /// \fn void stop()
+  /// \brief Stop the timer and the allocation accounting.
+  ///
+  void stop();
+  ///
+  /// \fn void reset()
+  /// \brief Reset the internal state, deleting all measured intervals.
+  ///
+  void reset();
+
+  ///
+  /// \fn inline const Timer & getTimer() const
+  /// \brief Retrieve the underlying timer.
+  ///
+  /// @return The timer used to measure the intervals
+  ///
+  inline const Timer & getTimer() const;
+  ///
+  /// \fn inline const AllocationCounters & getLastRun() const
+  /// \brief Retrieve the allocation counters of the last interval.
+  ///
+  /// @return The allocation counters of the last interval
+  ///
+  inline const AllocationCounters & getLastRun() const;
+  ///
+  /// \fn inline std::uint64_t getTotalAllocations() const
+  /// \brief Retrieve the number of allocations in all intervals.
+  ///
+  /// @return The total number of allocations
+  ///
+  inline std::uint64_t getTotalAllocations() const;
+  ///
+  /// \fn inline std::uint64_t getTotalAllocatedBytes() const
+  /// \brief Retrieve the number of bytes allocated in all intervals.
+  ///
+  /// @return The total number of allocated bytes
+  ///
+  inline std::uint64_t getTotalAllocatedBytes() const;
+  ///
+  /// \fn inline std::int64_t getPeakLiveBytes() const
+  /// \brief Retrieve the highest peak of live bytes in any interval.
+  ///
+  /// @return The highest peak of live bytes
+  ///
+  inline std::int64_t getPeakLiveBytes() const;
+  ///
+  /// \fn inline const Statistics<double> & getAllocationsPerRun() const
+  /// \brief Retrieve the statistics of the number of allocations per interval.
+  ///
+  /// @return The running statistics of allocations per interval
+  ///
+  inline const Statistics<double> & getAllocationsPerRun() const;
+  ///
+  /// \fn std::string getReport() const
+  /// \brief Format timer and allocation results in a human readable string.
+  ///
+  /// @return The formatted report
+  ///
+  std::string getReport() const;
+
+private:
+  Timer timer;
+  AllocationCounters begin;
+  std::int64_t outerPeak;
+  AllocationCounters lastRun;
+  std::uint64_t totalAllocations;
+  std::uint64_t totalAllocatedBytes;
+  std::int64_t peakLiveBytes;
+  Statistics<double> allocationsPerRun;
+};
+
+inline const Timer & AllocationProfiler::getTimer() const {
+  return timer;
+}
+
+inline const AllocationCounters & AllocationProfiler::getLastRun() const {
+  return lastRun;
+}
+
+inline std::uint64_t AllocationProfiler::getTotalAllocations() const {
+  return totalAllocations;
+}
+
+inline std::uint64_t AllocationProfiler::getTotalAllocatedBytes() const {
+  return totalAllocatedBytes;
+}
+
+inline std::int64_t AllocationProfiler::getPeakLiveBytes() const {
+  return peakLiveBytes;
+}
+
+inline const Statistics<double> & AllocationProfiler::getAllocationsPerRun() const {
+  return allocationsPerRun;
+}
+
+} // utils
+} // isa
@@ -0,0 +1,513 @@
+///
+/// \file Arena.hpp
+/// \brief
+///
+/// Arena and FixedSizePool memory resources, with their allocators.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <new>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cinttypes>
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define ISA_UTILS_HAS_PMR
+#endif
+#endif
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \class Arena
+/// \brief Monotonic bump allocator.
+///
+/// Memory is carved out of large chunks and only returned all at once by reset(); chunks are kept for reuse,
+/// so once the high-water mark has been reached an arena does not allocate any more memory.
+///
+class Arena {
+public:
+  ///
+  /// \fn explicit Arena(std::size_t chunkSize = 65536, std::size_t alignment = alignof(std::max_align_t))
+  /// \brief Constructor; no memory is allocated until the first request.
+  ///
+  /// @param chunkSize The size of the chunks requested to the system
+  /// @param alignment The default alignment of allocations, e.g. 64 to give every allocation its own cache line
+  ///
+  explicit Arena(std::size_t chunkSize = 65536, std::size_t alignment = alignof(std::max_align_t));
+  ///
+  /// \fn ~Arena()
+  /// \brief Destructor, frees all chunks.
+  ///
+  ~Arena();
+  Arena(const Arena &) = delete;
+  Arena & operator=(const Arena &) = delete;
+
+  ///
+  /// \fn void * allocate(std::size_t bytes, std::size_t alignment = 0)
+  /// \brief Allocate memory from the arena.
+  ///
+  /// @param bytes The size of the allocation
+  /// @param alignment The alignment of the allocation, a power of two; zero uses the default alignment of the arena
+  /// @return A pointer to the allocated memory
+  ///
+  void * allocate(std::size_t bytes, std::size_t alignment = 0);
+  ///
+  /// \fn void reset()
+  /// \brief Release all allocations, keeping the chunks for reuse.
+  ///
+  void reset();
+  ///
+  /// \fn void release()
+  /// \brief Release all allocations and free all chunks.
+  ///
+  void release();
+
+  ///
+  /// \fn inline std::size_t getUsedBytes() const
+  /// \brief Retrieve the number of bytes allocated since the last reset, including alignment padding.
+  ///
+  /// @return The number of used bytes
+  ///
+  inline std::size_t getUsedBytes() const;
+  ///
+  /// \fn inline std::size_t getHighWaterMark() const
+  /// \brief Retrieve the highest number of used bytes ever reached.
+  ///
+  /// @return The high-water mark in bytes
+  ///
+  inline std::size_t getHighWaterMark() const;
+  ///
+  /// \fn inline std::size_t getCapacity() const
+  /// \brief Retrieve the total size of the chunks owned by the arena.
+  ///
+  /// @return The capacity in bytes
+  ///
+  inline std::size_t getCapacity() const;
+  ///
+  /// \fn inline std::uint64_t getNrChunkAllocations() const
+  /// \brief Retrieve the number of chunks requested to the system.
+  ///
+  /// @return The number of chunk allocations
+  ///
+  inline std::uint64_t getNrChunkAllocations() const;
+
+  ///
+  /// \fn static Arena & getThreadLocal()
+  /// \brief Retrieve the arena owned by the calling thread.
+  ///
+  /// @return The thread local arena
+  ///
+  static Arena & getThreadLocal();
+
+private:
+  struct Chunk {
+    unsigned char * memory;
+    std::size_t size;
+    std::size_t alignment;
+  };
+
+  void newChunk(std::size_t bytes, std::size_t alignment);
+
+  std::vector<Chunk> chunks;
+  std::size_t chunkSize;
+  std::size_t alignment;
+  std::size_t current;
+  std::size_t offset;
+  std::size_t usedBytes;
+  std::size_t highWaterMark;
+  std::size_t capacity;
+  std::uint64_t nrChunkAllocations;
+};
+
+///
+/// \class FixedSizePool
+/// \brief Pool of equally sized memory blocks, recycled through a free list.
+///
+class FixedSizePool {
+public:
+  ///
+  /// \fn FixedSizePool(std::size_t blockSize, std::size_t alignment = alignof(std::max_align_t), std::size_t blocksPerChunk = 1024)
+  /// \brief Constructor; no memory is allocated until the first request.
+  ///
+  /// @param blockSize The size of every block
+  /// @param alignment The alignment of every block, a power of two
+  /// @param blocksPerChunk The number of blocks requested to the system at once
+  ///
+  FixedSizePool(std::size_t blockSize, std::size_t alignment = alignof(std::max_align_t), std::size_t blocksPerChunk = 1024);
+  ///
+  /// \fn ~FixedSizePool()
+  /// \brief Destructor, frees all chunks.
+  ///
+  ~FixedSizePool();
+  FixedSizePool(const FixedSizePool &) = delete;
+  FixedSizePool & operator=(const FixedSizePool &) = delete;
+
+  ///
+  /// \fn inline void * allocate()
+  /// \brief Take a block from the pool.
+  ///
+  /// @return A pointer to the block
+  ///
+  inline void * allocate();
+  ///
+  /// \fn inline void deallocate(void * block)
+  /// \brief Return a block to the pool.
+  ///
+  /// @param block The block to return
+  ///
+  inline void deallocate(void * block);
+
+  ///
+  /// \fn inline std::size_t getBlockSize() const
+  /// \brief Retrieve the size of the blocks.
+  ///
+  /// @return The size of the blocks, in bytes
+  ///
+  inline std::size_t getBlockSize() const;
+  ///
+  /// \fn inline std::size_t getAlignment() const
+  /// \brief Retrieve the alignment of the blocks.
+  ///
+  /// @return The alignment of the blocks, in bytes
+  ///
+  inline std::size_t getAlignment() const;
+  ///
+  /// \fn inline std::size_t getNrLiveBlocks() const
+  /// \brief Retrieve the number of blocks currently taken from the pool.
+  ///
+  /// @return The number of live blocks
+  ///
+  inline std::size_t getNrLiveBlocks() const;
+  ///
+  /// \fn inline std::size_t getHighWaterMark() const
+  /// \brief Retrieve the highest number of live blocks ever reached.
+  ///
+  /// @return The high-water mark in blocks
+  ///
+  inline std::size_t getHighWaterMark() const;
+  ///
+  /// \fn inline std::uint64_t getNrChunkAllocations() const
+  /// \brief Retrieve the number of chunks requested to the system.
+  ///
+  /// @return The number of chunk allocations
+  ///
+  inline std::uint64_t getNrChunkAllocations() const;
+
+private:
+  struct FreeBlock {
+    FreeBlock * next;
+  };
+
+  void grow();
+
+  std::vector<void *> chunks;
+  FreeBlock * freeList;
+  std::size_t blockSize;
+  std::size_t alignment;
+  std::size_t blocksPerChunk;
+  std::size_t nrLiveBlocks;
+  std::size_t highWaterMark;
+  std::uint64_t nrChunkAllocations;
+};
+
+///
+/// \class ObjectPool
+/// \brief Typed FixedSizePool, constructing and destroying objects in place.
+///
+template<typename T> class ObjectPool {
+public:
+  ///
+  /// \fn explicit ObjectPool(std::size_t objectsPerChunk = 1024)
+  /// \brief Constructor.
+  ///
+  /// @param objectsPerChunk The number of objects requested to the system at once
+  ///
+  explicit ObjectPool(std::size_t objectsPerChunk = 1024);
+
+  ///
+  /// \fn template<typename... Arguments> T * create(Arguments &&... arguments)
+  /// \brief Construct an object in a block of the pool.
+  ///
+  /// @param arguments The arguments of the constructor
+  /// @return A pointer to the new object
+  ///
+  template<typename... Arguments> T * create(Arguments &&... arguments);
+  ///
+  /// \fn void destroy(T * object)
+  /// \brief Destroy an object and return its block to the pool.
+  ///
+  /// @param object The object to destroy
+  ///
+  void destroy(T * object);
+  ///
+  /// \fn inline const FixedSizePool & getPool() const
+  /// \brief Retrieve the underlying pool, e.g. for its counters.
+  ///
+  /// @return The underlying pool
+  ///
+  inline const FixedSizePool & getPool() const;
+
+private:
+  FixedSizePool pool;
+};
+
+///
+/// \class ArenaAllocator
+/// \brief Standard library compatible allocator backed by an Arena; deallocation is a no-op.
+///
+template<typename T> class ArenaAllocator {
+public:
+  using value_type = T;
+  template<typename U> struct rebind {
+    using other = ArenaAllocator<U>;
+  };
+
+  ///
+  /// \fn explicit ArenaAllocator(Arena & arena = Arena::getThreadLocal())
+  /// \brief Constructor.
+  ///
+  /// @param arena The arena to allocate from
+  ///
+  explicit ArenaAllocator(Arena & arena = Arena::getThreadLocal()) noexcept : arena(&arena) {}
+  template<typename U> ArenaAllocator(const ArenaAllocator<U> & other) noexcept : arena(&other.getArena()) {}
+
+  inline T * allocate(std::size_t nrElements) {
+    if ( nrElements > std::numeric_limits<std::size_t>::max() / sizeof(T) ) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(arena->allocate(nrElements * sizeof(T), alignof(T)));
+  }
+  inline void deallocate(T *, std::size_t) noexcept {}
+  inline Arena & getArena() const noexcept {
+    return *arena;
+  }
+
+private:
+  Arena * arena;
+};
+
+template<typename T, typename U> inline bool operator==(const ArenaAllocator<T> & left, const ArenaAllocator<U> & right) noexcept {
+  return &left.getArena() == &right.getArena();
+}
+
+template<typename T, typename U> inline bool operator!=(const ArenaAllocator<T> & left, const ArenaAllocator<U> & right) noexcept {
+  return !(left == right);
+}
+
+///
+/// \class PoolAllocator
+/// \brief Standard library compatible allocator serving single-object requests from a FixedSizePool.
+///
+/// Intended for node based containers, e.g. std::list and std::map: the pool block size must be large enough for their nodes.
+/// Requests that do not fit in a block are forwarded to operator new.
+///
+template<typename T> class PoolAllocator {
+public:
+  using value_type = T;
+  template<typename U> struct rebind {
+    using other = PoolAllocator<U>;
+  };
+
+  ///
+  /// \fn explicit PoolAllocator(FixedSizePool & pool)
+  /// \brief Constructor.
+  ///
+  /// @param pool The pool to allocate from
+  ///
+  explicit PoolAllocator(FixedSizePool & pool) noexcept : pool(&pool) {}
+  template<typename U> PoolAllocator(const PoolAllocator<U> & other) noexcept : pool(&other.getPool()) {}
+
+  inline T * allocate(std::size_t nrElements) {
+    if ( nrElements == 1 && sizeof(T) <= pool->getBlockSize() && alignof(T) <= pool->getAlignment() ) {
+      return static_cast<T *>(pool->allocate());
+    }
+    if ( nrElements > std::numeric_limits<std::size_t>::max() / sizeof(T) ) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(::operator new(nrElements * sizeof(T)));
+  }
+  inline void deallocate(T * pointer, std::size_t nrElements) noexcept {
+    if ( nrElements == 1 && sizeof(T) <= pool->getBlockSize() && alignof(T) <= pool->getAlignment() ) {
+      pool->deallocate(pointer);
+    } else {
+      ::operator delete(pointer);
+    }
+  }
+  inline FixedSizePool & getPool() const noexcept {
+    return *pool;
+  }
+
+private:
+  FixedSizePool * pool;
+};
+
+template<typename T, typename U> inline bool operator==(const PoolAllocator<T> & left, const PoolAllocator<U> & right) noexcept {
+  return &left.getPool() == &right.getPool();
+}
+
+template<typename T, typename U> inline bool operator!=(const PoolAllocator<T> & left, const PoolAllocator<U> & right) noexcept {
+  return !(left == right);
+}
+
+#ifdef ISA_UTILS_HAS_PMR
+///
+/// \class ArenaResource
+/// \brief std::pmr::memory_resource adapter for an Arena.
+///
+class ArenaResource : public std::pmr::memory_resource {
+public:
+  explicit ArenaResource(Arena & arena = Arena::getThreadLocal()) noexcept : arena(arena) {}
+
+private:
+  void * do_allocate(std::size_t bytes, std::size_t alignment) override {
+    return arena.allocate(bytes, alignment);
+  }
+  void do_deallocate(void *, std::size_t, std::size_t) override {}
+  bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override {
+    return this == &other;
+  }
+
+  Arena & arena;
+};
+
+///
+/// \class PoolResource
+/// \brief std::pmr::memory_resource adapter for a FixedSizePool; requests that do not fit in a block are forwarded to an upstream resource.
+///
+class PoolResource : public std::pmr::memory_resource {
+public:
+  explicit PoolResource(FixedSizePool & pool, std::pmr::memory_resource * upstream = std::pmr::get_default_resource()) noexcept : pool(pool), upstream(upstream) {}
+
+private:
+  void * do_allocate(std::size_t bytes, std::size_t alignment) override {
+    if ( bytes <= pool.getBlockSize() && alignment <= pool.getAlignment() ) {
+      return pool.allocate();
+    }
+    return upstream->allocate(bytes, alignment);
+  }
+  void do_deallocate(void * pointer, std::size_t bytes, std::size_t alignment) override {
+    if ( bytes <= pool.getBlockSize() && alignment <= pool.getAlignment() ) {
+      pool.deallocate(pointer);
+    } else {
+      upstream->deallocate(pointer, bytes, alignment);
+    }
+  }
+  bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override {
+    return this == &other;
+  }
+
+  FixedSizePool & pool;
+  std::pmr::memory_resource * upstream;
+};
+#endif // ISA_UTILS_HAS_PMR
+
+inline std::size_t Arena::getUsedBytes() const {
+  return usedBytes;
+}
+
+inline std::size_t Arena::getHighWaterMark() const {
+  return highWaterMark;
+}
+
+inline std::size_t Arena::getCapacity() const {
+  return capacity;
+}
+
+inline std::uint64_t Arena::getNrChunkAllocations() const {
+  return nrChunkAllocations;
+}
+
+inline void * FixedSizePool::allocate() {
+  if ( freeList == nullptr ) {
+    grow();
+  }
+  FreeBlock * block = freeList;
+
+  freeList = block->next;
+  nrLiveBlocks++;
+  if ( nrLiveBlocks > highWaterMark ) {
+    highWaterMark = nrLiveBlocks;
+  }
+
+  return block;
+}
+
+inline void FixedSizePool::deallocate(void * block) {
+  if ( block == nullptr ) {
+    return;
+  }
+  FreeBlock * freeBlock = static_cast<FreeBlock *>(block);
+
+  freeBlock->next = freeList;
+  freeList = freeBlock;
+  nrLiveBlocks--;
+}
+
+inline std::size_t FixedSizePool::getBlockSize() const {
+  return blockSize;
+}
+
+inline std::size_t FixedSizePool::getAlignment() const {
+  return alignment;
+}
+
+inline std::size_t FixedSizePool::getNrLiveBlocks() const {
+  return nrLiveBlocks;
+}
+
+inline std::size_t FixedSizePool::getHighWaterMark() const {
+  return highWaterMark;
+}
+
+inline std::uint64_t FixedSizePool::getNrChunkAllocations() const {
+  return nrChunkAllocations;
+}
+
+template<typename T> ObjectPool<T>::ObjectPool(const std::size_t objectsPerChunk) : pool(sizeof(T), alignof(T), objectsPerChunk) {}
+
+template<typename T> template<typename... Arguments> T * ObjectPool<T>::create(Arguments &&... arguments) {
+  void * block = pool.allocate();
+
+  try {
+    return new (block) T(std::forward<Arguments>(arguments)...);
+  } catch ( ... ) {
+    pool.deallocate(block);
+    throw;
+  }
+}
+
+template<typename T> void ObjectPool<T>::destroy(T * object) {
+  if ( object == nullptr ) {
+    return;
+  }
+  object->~T();
+  pool.deallocate(object);
+}
+
+template<typename T> inline const FixedSizePool & ObjectPool<T>::getPool() const {
+  return pool;
+}
+
+} // utils
+} // isa
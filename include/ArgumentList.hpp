@@ -118,6 +118,20 @@ private:
 };
 
 
+inline SwitchNotFound::SwitchNotFound(const std::string & option) {
+  this->errorMessage = "ERROR: expected switch \"" + option + "\" not found";
+}
+
+inline const char * SwitchNotFound::what() const noexcept {
+  return this->errorMessage.c_str();
+}
+
+inline ArgumentList::ArgumentList(int argc, char * argv[]) : name(std::string(argv[0])) {
+  for ( int i = 1; i < argc; i++ ) {
+    args.emplace_back(argv[i]);
+  }
+}
+
 inline std::string ArgumentList::getName() const {
   return name;
 }
@@ -132,6 +146,21 @@ template<typename T> T ArgumentList::getFirst() {
   return isa::utils::castToType<std::string, T>(temp);
 }
 
+inline bool ArgumentList::getSwitch(const std::string & option) {
+  if ( args.empty() ) {
+    return false;
+  }
+
+  for ( auto s = args.begin(); s != args.end(); ++s ) {
+    if (option == *s) {
+      args.erase(s);
+      return true;
+    }
+  }
+
+  return false;
+}
+
 template<class T> T ArgumentList::getSwitchArgument(const std::string & option) {
   if ( args.empty() ) {
     throw EmptyCommandLine();
@@ -0,0 +1,309 @@
+///
+/// \file Bitmap.hpp
+/// \brief
+///
+/// Bitmap class, for large flag masks, and functions to apply masks to arrays.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+#include <exception>
+#include <cstddef>
+#include <cinttypes>
+
+#include "PaddedBuffer.hpp"
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \class BitmapError
+/// \extends std::exception
+/// \brief Represents an operation between bitmaps of different sizes.
+///
+class BitmapError : public std::exception {
+public:
+  ///
+  /// \fn explicit BitmapError(const std::string & message)
+  /// \brief Constructor.
+  ///
+  /// @param message The explanation of the error
+  ///
+  explicit BitmapError(const std::string & message);
+
+  ///
+  /// \fn const char * what() const
+  /// \brief Provides the error message that explains the exception.
+  ///
+  /// @return A string containing the explanation for the raised exception
+  ///
+  const char * what() const noexcept override;
+
+private:
+  std::string errorMessage;
+};
+
+///
+/// \enum BitmapKernel
+/// \brief Implementations of the bulk bitmap operations.
+///
+enum class BitmapKernel {
+  Scalar,
+  AVX2,
+  AVX512
+};
+
+///
+/// \class Bitmap
+/// \brief Dynamic bitset stored in 64 bits words.
+///
+/// Bit i is bit i % 64 of word i / 64, the same order used by getBit() and setBit(). The storage is padded to 64 bytes,
+/// and all bits after the last one are always zero.
+///
+class Bitmap {
+public:
+  /// Returned by the search functions when no bit is found
+  static constexpr std::size_t npos = ~static_cast<std::size_t>(0);
+
+  ///
+  /// \fn explicit Bitmap(std::size_t nrBits = 0, bool value = false)
+  /// \brief Constructor.
+  ///
+  /// @param nrBits The number of bits
+  /// @param value The initial value of all bits
+  ///
+  explicit Bitmap(std::size_t nrBits = 0, bool value = false);
+
+  ///
+  /// \fn inline bool test(std::size_t bit) const
+  /// \brief Read a bit; a BitmapError is thrown if the bit is outside of the bitmap.
+  ///
+  /// @param bit The position of the bit
+  /// @return True if the bit is set
+  ///
+  inline bool test(std::size_t bit) const;
+  ///
+  /// \fn inline void set(std::size_t bit)
+  /// \brief Set a bit; a BitmapError is thrown if the bit is outside of the bitmap.
+  ///
+  /// @param bit The position of the bit
+  ///
+  inline void set(std::size_t bit);
+  ///
+  /// \fn inline void clear(std::size_t bit)
+  /// \brief Clear a bit; a BitmapError is thrown if the bit is outside of the bitmap.
+  ///
+  /// @param bit The position of the bit
+  ///
+  inline void clear(std::size_t bit);
+  ///
+  /// \fn void setRange(std::size_t first, std::size_t last)
+  /// \brief Set all bits in [first, last).
+  ///
+  /// @param first The first bit to set
+  /// @param last The bit after the last one to set
+  ///
+  void setRange(std::size_t first, std::size_t last);
+  ///
+  /// \fn void clearRange(std::size_t first, std::size_t last)
+  /// \brief Clear all bits in [first, last).
+  ///
+  /// @param first The first bit to clear
+  /// @param last The bit after the last one to clear
+  ///
+  void clearRange(std::size_t first, std::size_t last);
+
+  ///
+  /// \fn Bitmap & operator&=(const Bitmap & other)
+  /// \brief Keep only the bits set in both bitmaps.
+  ///
+  /// @param other A bitmap with the same number of bits
+  /// @return This bitmap
+  ///
+  Bitmap & operator&=(const Bitmap & other);
+  ///
+  /// \fn Bitmap & operator|=(const Bitmap & other)
+  /// \brief Set the bits set in either bitmap.
+  ///
+  /// @param other A bitmap with the same number of bits
+  /// @return This bitmap
+  ///
+  Bitmap & operator|=(const Bitmap & other);
+  ///
+  /// \fn Bitmap & operator^=(const Bitmap & other)
+  /// \brief Set the bits set in only one of the bitmaps.
+  ///
+  /// @param other A bitmap with the same number of bits
+  /// @return This bitmap
+  ///
+  Bitmap & operator^=(const Bitmap & other);
+  ///
+  /// \fn Bitmap & andNot(const Bitmap & other)
+  /// \brief Clear the bits set in the other bitmap.
+  ///
+  /// @param other A bitmap with the same number of bits
+  /// @return This bitmap
+  ///
+  Bitmap & andNot(const Bitmap & other);
+
+  ///
+  /// \fn std::size_t count() const
+  /// \brief Count the set bits.
+  ///
+  /// @return The number of set bits
+  ///
+  std::size_t count() const;
+  ///
+  /// \fn std::size_t findFirst() const
+  /// \brief Find the first set bit.
+  ///
+  /// @return The position of the first set bit, or npos
+  ///
+  std::size_t findFirst() const;
+  ///
+  /// \fn std::size_t findNext(std::size_t bit) const
+  /// \brief Find the first set bit after a given position.
+  ///
+  /// @param bit The position to start from, excluded
+  /// @return The position of the next set bit, or npos
+  ///
+  std::size_t findNext(std::size_t bit) const;
+
+  ///
+  /// \fn inline std::size_t getNrBits() const
+  /// \brief Retrieve the number of bits.
+  ///
+  /// @return The number of bits
+  ///
+  inline std::size_t getNrBits() const;
+  ///
+  /// \fn inline std::size_t getNrWords() const
+  /// \brief Retrieve the number of words in the storage, including padding.
+  ///
+  /// @return The number of words
+  ///
+  inline std::size_t getNrWords() const;
+  ///
+  /// \fn inline const std::uint64_t * data() const
+  /// \brief Retrieve the words of the bitmap.
+  ///
+  /// @return A pointer to the first word
+  ///
+  inline const std::uint64_t * data() const;
+
+private:
+  std::size_t findFrom(std::size_t bit) const;
+  void checkSize(const Bitmap & other) const;
+  inline void checkBit(std::size_t bit) const;
+  // Out of line, so that the inline accessors stay small
+  [[noreturn]] void throwOutOfRange(std::size_t bit) const;
+
+  std::size_t nrBits;
+  std::vector<std::uint64_t, AlignedAllocator<std::uint64_t>> words;
+};
+
+///
+/// \fn BitmapKernel getBitmapKernel()
+/// \brief Retrieve the kernel selected, at run time, for the running CPU, or forced with setBitmapKernel().
+///
+/// @return The kernel used by the bulk bitmap operations
+///
+BitmapKernel getBitmapKernel();
+///
+/// \fn bool setBitmapKernel(BitmapKernel kernel)
+/// \brief Force the kernel used by the bulk bitmap operations, e.g. to test the kernels that are not the fastest on the running CPU.
+///
+/// The selection is global, and not synchronized with concurrent bitmap operations.
+///
+/// @param kernel The kernel to use
+/// @return True if the running CPU supports the kernel and it has been selected, false otherwise
+///
+bool setBitmapKernel(BitmapKernel kernel);
+///
+/// \fn bool isSupported(BitmapKernel kernel)
+/// \brief Check if the running CPU supports a kernel.
+///
+/// @param kernel The kernel
+/// @return True if the kernel can be used, false otherwise
+///
+bool isSupported(BitmapKernel kernel);
+///
+/// \fn std::string toString(BitmapKernel kernel)
+/// \brief Retrieve the name of a kernel.
+///
+/// @param kernel The kernel
+/// @return The name of the kernel
+///
+std::string toString(BitmapKernel kernel);
+///
+/// \fn void applyMask(const Bitmap & mask, float * data, float value = 0.0f)
+/// \brief Replace the flagged samples of an array, i.e. the ones whose bit is set in the mask.
+///
+/// @param mask The mask, with one bit per sample
+/// @param data The array, with mask.getNrBits() samples
+/// @param value The value of the flagged samples
+///
+void applyMask(const Bitmap & mask, float * data, float value = 0.0f);
+///
+/// \fn std::size_t compact(const Bitmap & mask, const float * input, float * output)
+/// \brief Copy the samples that are not flagged, preserving their order. Input and output can be the same array.
+///
+/// @param mask The mask, with one bit per sample
+/// @param input The array to read, with mask.getNrBits() samples
+/// @param output The array to write, large enough for mask.getNrBits() samples
+/// @return The number of samples copied
+///
+std::size_t compact(const Bitmap & mask, const float * input, float * output);
+
+
+inline bool Bitmap::test(const std::size_t bit) const {
+  checkBit(bit);
+  return ((words[bit / 64] >> (bit % 64)) & 1) != 0;
+}
+
+inline void Bitmap::set(const std::size_t bit) {
+  checkBit(bit);
+  words[bit / 64] |= static_cast<std::uint64_t>(1) << (bit % 64);
+}
+
+inline void Bitmap::clear(const std::size_t bit) {
+  checkBit(bit);
+  words[bit / 64] &= ~(static_cast<std::uint64_t>(1) << (bit % 64));
+}
+
+inline void Bitmap::checkBit(const std::size_t bit) const {
+  if ( bit >= nrBits ) {
+    throwOutOfRange(bit);
+  }
+}
+
+inline std::size_t Bitmap::getNrBits() const {
+  return nrBits;
+}
+
+inline std::size_t Bitmap::getNrWords() const {
+  return words.size();
+}
+
+inline const std::uint64_t * Bitmap::data() const {
+  return words.data();
+}
+
+} // utils
+} // isa
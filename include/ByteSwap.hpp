@@ -0,0 +1,185 @@
+///
+/// \file ByteSwap.hpp
+/// \brief
+///
+/// Bulk byte swapping of arrays of 16, 32 and 64 bits values.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <cstddef>
+#include <cinttypes>
+#include <cstring>
+#include <type_traits>
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \enum ByteSwapKernel
+/// \brief Implementations of the bulk byte swapping.
+///
+enum class ByteSwapKernel {
+  Scalar,
+  SSSE3,
+  AVX2,
+  AVX512
+};
+
+///
+/// \enum Endianness
+/// \brief Byte order of multi-byte values.
+///
+enum class Endianness {
+  Little,
+  Big
+};
+
+///
+/// \fn constexpr Endianness nativeEndianness()
+/// \brief Retrieve the byte order of the machine the code is compiled for.
+///
+/// @return The native byte order
+///
+constexpr Endianness nativeEndianness();
+///
+/// \fn template<typename T> T byteSwap(T value)
+/// \brief Change the endianness of a single value.
+///
+/// @param value The value to convert
+/// @return The value with its bytes in reverse order
+///
+template<typename T> T byteSwap(T value);
+///
+/// \fn ByteSwapKernel getByteSwapKernel()
+/// \brief Retrieve the kernel selected, at run time, for the running CPU, or forced with setByteSwapKernel().
+///
+/// @return The kernel used by byteSwap()
+///
+ByteSwapKernel getByteSwapKernel();
+///
+/// \fn bool setByteSwapKernel(ByteSwapKernel kernel)
+/// \brief Force the kernel used by byteSwap(), e.g. to test the kernels that are not the fastest on the running CPU.
+///
+/// The selection is global, and not synchronized with concurrent calls to byteSwap().
+///
+/// @param kernel The kernel to use
+/// @return True if the running CPU supports the kernel and it has been selected, false otherwise
+///
+bool setByteSwapKernel(ByteSwapKernel kernel);
+///
+/// \fn bool isSupported(ByteSwapKernel kernel)
+/// \brief Check if the running CPU supports a kernel.
+///
+/// @param kernel The kernel
+/// @return True if the kernel can be used, false otherwise
+///
+bool isSupported(ByteSwapKernel kernel);
+///
+/// \fn std::string toString(ByteSwapKernel kernel)
+/// \brief Retrieve the name of a kernel.
+///
+/// @param kernel The kernel
+/// @return The name of the kernel
+///
+std::string toString(ByteSwapKernel kernel);
+///
+/// \fn template<std::size_t Width> void byteSwapArray(const void * input, void * output, std::size_t nrElements)
+/// \brief Reverse the order of the bytes of every Width bytes element of an array.
+///
+/// Specialized for widths of 1, 2, 4 and 8 bytes; a width of 1 byte is a plain copy. Input and output can be the same array, but must not otherwise overlap.
+///
+/// @param input The array to read
+/// @param output The array to write
+/// @param nrElements The number of elements in the arrays
+///
+template<std::size_t Width> void byteSwapArray(const void * input, void * output, std::size_t nrElements);
+template<> void byteSwapArray<1>(const void * input, void * output, std::size_t nrElements);
+template<> void byteSwapArray<2>(const void * input, void * output, std::size_t nrElements);
+template<> void byteSwapArray<4>(const void * input, void * output, std::size_t nrElements);
+template<> void byteSwapArray<8>(const void * input, void * output, std::size_t nrElements);
+///
+/// \fn template<typename T> void byteSwap(T * data, std::size_t nrElements)
+/// \brief Change the endianness of all elements of an array, in place.
+///
+/// @param data The array to modify
+/// @param nrElements The number of elements in the array
+///
+template<typename T> void byteSwap(T * data, std::size_t nrElements);
+///
+/// \fn template<typename T> void byteSwap(const T * input, T * output, std::size_t nrElements)
+/// \brief Change the endianness of all elements of an array, storing the result in a different array.
+///
+/// @param input The array to read
+/// @param output The array to write
+/// @param nrElements The number of elements in the arrays
+///
+template<typename T> void byteSwap(const T * input, T * output, std::size_t nrElements);
+
+
+constexpr Endianness nativeEndianness() {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  return Endianness::Big;
+#else
+  return Endianness::Little;
+#endif
+}
+
+// Unsigned integer overloads used by byteSwap(T value)
+inline std::uint8_t byteSwapBits(const std::uint8_t bits) {
+  return bits;
+}
+
+inline std::uint16_t byteSwapBits(const std::uint16_t bits) {
+  return __builtin_bswap16(bits);
+}
+
+inline std::uint32_t byteSwapBits(const std::uint32_t bits) {
+  return __builtin_bswap32(bits);
+}
+
+inline std::uint64_t byteSwapBits(const std::uint64_t bits) {
+  return __builtin_bswap64(bits);
+}
+
+template<typename T> inline T byteSwap(const T value) {
+  static_assert(std::is_arithmetic<T>::value, "byteSwap() is only defined for arithmetic types.");
+  static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "byteSwap() is only defined for 8, 16, 32 and 64 bits types.");
+  using Bits = typename std::conditional<sizeof(T) == 1, std::uint8_t, typename std::conditional<sizeof(T) == 2, std::uint16_t, typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type>::type>::type;
+  Bits bits;
+  T swapped;
+
+  std::memcpy(&bits, &value, sizeof(T));
+  bits = byteSwapBits(bits);
+  std::memcpy(&swapped, &bits, sizeof(T));
+
+  return swapped;
+}
+
+template<typename T> inline void byteSwap(T * data, const std::size_t nrElements) {
+  byteSwap(static_cast<const T *>(data), data, nrElements);
+}
+
+template<typename T> inline void byteSwap(const T * input, T * output, const std::size_t nrElements) {
+  static_assert(std::is_arithmetic<T>::value, "byteSwap() is only defined for arithmetic types.");
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "byteSwap() is only defined for 16, 32 and 64 bits types.");
+  byteSwapArray<sizeof(T)>(input, output, nrElements);
+}
+
+} // utils
+} // isa
@@ -0,0 +1,120 @@
+///
+/// \file Compare.hpp
+/// \brief
+///
+/// Bulk comparison of floating point arrays, with absolute, relative and ULP tolerances.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <cstddef>
+#include <cinttypes>
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \enum CompareKernel
+/// \brief Implementations of the bulk comparison.
+///
+enum class CompareKernel {
+  Scalar,
+  AVX2
+};
+
+///
+/// \enum ToleranceMode
+/// \brief How the difference between two values is measured.
+///
+enum class ToleranceMode {
+  /// |result - expected| < value, as in same()
+  Absolute,
+  /// |result - expected| < value * |expected|
+  Relative,
+  /// At most value representable numbers between result and expected
+  ULP
+};
+
+///
+/// \struct Tolerance
+/// \brief The accepted difference between two values.
+///
+struct Tolerance {
+  ToleranceMode mode = ToleranceMode::Absolute;
+  double value = 1.0e-06;
+};
+
+///
+/// \struct ComparisonResult
+/// \brief Summary of the comparison of two arrays.
+///
+/// Equal values, including zeros of different sign, infinities of the same sign and two NaNs, always match.
+/// A NaN compared with a number has infinite absolute and relative errors.
+///
+struct ComparisonResult {
+  /// Returned as index when there are no mismatches
+  static constexpr std::size_t npos = ~static_cast<std::size_t>(0);
+
+  /// The number of compared elements
+  std::size_t nrElements = 0;
+  /// The number of elements outside the tolerance
+  std::size_t nrMismatches = 0;
+  /// The index of the first mismatch
+  std::size_t firstMismatch = npos;
+  /// The index of the mismatch with the largest error, measured as in the tolerance mode
+  std::size_t worstMismatch = npos;
+  /// The error of the worst mismatch, measured as in the tolerance mode
+  double worstError = 0.0;
+  /// The largest absolute error
+  double maxAbsoluteError = 0.0;
+  /// The largest relative error
+  double maxRelativeError = 0.0;
+  /// The largest distance in units in the last place, only computed with a ULP tolerance
+  std::uint64_t maxULPError = 0;
+};
+
+///
+/// \fn template<typename T> ComparisonResult compare(const T * result, const T * expected, std::size_t nrElements, const Tolerance & tolerance = Tolerance(), unsigned int nrThreads = 1)
+/// \brief Compare two arrays element by element. Instantiated for float and double.
+///
+/// @param result The array to verify
+/// @param expected The reference array
+/// @param nrElements The number of elements in the arrays
+/// @param tolerance The accepted difference between the elements
+/// @param nrThreads The number of threads sharing the comparison
+/// @return The summary of the comparison
+///
+template<typename T> ComparisonResult compare(const T * result, const T * expected, std::size_t nrElements, const Tolerance & tolerance = Tolerance(), unsigned int nrThreads = 1);
+///
+/// \fn CompareKernel getCompareKernel()
+/// \brief Retrieve the kernel selected, at run time, for the running CPU.
+///
+/// @return The kernel used by compare()
+///
+CompareKernel getCompareKernel();
+///
+/// \fn std::string toString(CompareKernel kernel)
+/// \brief Retrieve the name of a kernel.
+///
+/// @param kernel The kernel
+/// @return The name of the kernel
+///
+std::string toString(CompareKernel kernel);
+
+} // utils
+} // isa
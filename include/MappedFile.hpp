@@ -0,0 +1,336 @@
+///
+/// \file MappedFile.hpp
+/// \brief
+///
+/// MappedFile class, RecordView class and related error types.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <type_traits>
+
+#include "ByteSwap.hpp"
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \class MappedFileError
+/// \extends std::exception
+/// \brief Represents the failure to map a file, or an access outside of the mapped file.
+///
+class MappedFileError : public std::exception {
+public:
+  ///
+  /// \fn explicit MappedFileError(const std::string & message)
+  /// \brief Constructor.
+  ///
+  /// @param message The explanation of the error
+  ///
+  explicit MappedFileError(const std::string & message);
+
+  ///
+  /// \fn const char * what() const
+  /// \brief Provides the error message that explains the exception.
+  ///
+  /// @return A string containing the explanation for the raised exception
+  ///
+  const char * what() const noexcept override;
+
+private:
+  std::string errorMessage;
+};
+
+///
+/// \enum AccessPattern
+/// \brief Hints on how a mapped file is going to be accessed, passed to madvise().
+///
+enum class AccessPattern {
+  /// No special treatment
+  Normal,
+  /// Pages are accessed in order, read ahead aggressively and free them soon after
+  Sequential,
+  /// Pages are accessed in random order, do not read ahead
+  Random,
+  /// Pages are going to be accessed soon, start reading them
+  WillNeed,
+  /// Pages are not going to be accessed soon, drop them from the page cache of the process
+  DontNeed,
+  /// Back the mapping with transparent huge pages, if the file system supports it
+  HugePage
+};
+
+///
+/// \class MappedFile
+/// \brief Read-only memory mapping of a whole file.
+///
+/// Pages are read from disk on first access, so the file can be larger than the available memory.
+///
+class MappedFile {
+public:
+  ///
+  /// \fn explicit MappedFile(const std::string & path)
+  /// \brief Constructor, maps the file.
+  ///
+  /// @param path The file to map
+  ///
+  explicit MappedFile(const std::string & path);
+  ///
+  /// \fn ~MappedFile()
+  /// \brief Destructor, unmaps the file.
+  ///
+  ~MappedFile();
+  MappedFile(const MappedFile &) = delete;
+  MappedFile & operator=(const MappedFile &) = delete;
+  ///
+  /// \fn MappedFile(MappedFile && other)
+  /// \brief Move constructor.
+  ///
+  /// @param other The mapping to take ownership of
+  ///
+  MappedFile(MappedFile && other) noexcept;
+  ///
+  /// \fn MappedFile & operator=(MappedFile && other)
+  /// \brief Move assignment.
+  ///
+  /// @param other The mapping to take ownership of
+  /// @return This object
+  ///
+  MappedFile & operator=(MappedFile && other) noexcept;
+
+  ///
+  /// \fn bool advise(AccessPattern pattern)
+  /// \brief Provide an access pattern hint for the whole file.
+  ///
+  /// @param pattern The expected access pattern
+  /// @return True if the hint has been accepted by the operating system, false otherwise
+  ///
+  bool advise(AccessPattern pattern);
+  ///
+  /// \fn bool advise(AccessPattern pattern, std::size_t offset, std::size_t length)
+  /// \brief Provide an access pattern hint for a range of the file.
+  ///
+  /// The range is extended to page boundaries.
+  ///
+  /// @param pattern The expected access pattern
+  /// @param offset The first byte of the range
+  /// @param length The length in bytes of the range
+  /// @return True if the hint has been accepted by the operating system, false otherwise
+  ///
+  bool advise(AccessPattern pattern, std::size_t offset, std::size_t length);
+
+  ///
+  /// \fn inline const unsigned char * getData() const
+  /// \brief Retrieve the first byte of the mapped file.
+  ///
+  /// @return A pointer to the mapped file, or nullptr if the file is empty
+  ///
+  inline const unsigned char * getData() const;
+  ///
+  /// \fn inline std::size_t getSize() const
+  /// \brief Retrieve the size of the mapped file.
+  ///
+  /// @return The size, in bytes, of the mapped file
+  ///
+  inline std::size_t getSize() const;
+  ///
+  /// \fn inline std::string getPath() const
+  /// \brief Retrieve the path of the mapped file.
+  ///
+  /// @return The path of the mapped file
+  ///
+  inline std::string getPath() const;
+
+private:
+  std::string path;
+  unsigned char * data;
+  std::size_t size;
+};
+
+///
+/// \class RecordView
+/// \brief Typed view of a field of fixed-size records stored in a MappedFile.
+///
+/// Values are converted to the native byte order when loaded; if the file is stored in native byte order,
+/// contiguous and aligned fields can be accessed directly without any copy.
+///
+template<typename T> class RecordView {
+public:
+  ///
+  /// \fn RecordView(const MappedFile & file, Endianness endianness, std::size_t offset = 0, std::size_t stride = sizeof(T), std::size_t nrRecords = 0)
+  /// \brief Constructor.
+  ///
+  /// @param file The mapped file containing the records
+  /// @param endianness The byte order of the values in the file
+  /// @param offset The position, in bytes, of the field in the first record
+  /// @param stride The distance, in bytes, between two consecutive records
+  /// @param nrRecords The number of records; if zero, all the records fitting in the file
+  ///
+  RecordView(const MappedFile & file, Endianness endianness, std::size_t offset = 0, std::size_t stride = sizeof(T), std::size_t nrRecords = 0);
+
+  ///
+  /// \fn inline std::size_t size() const
+  /// \brief Retrieve the number of records in the view.
+  ///
+  /// @return The number of records
+  ///
+  inline std::size_t size() const;
+  ///
+  /// \fn inline T operator[](std::size_t record) const
+  /// \brief Load the field of a record, without bounds checking.
+  ///
+  /// @param record The index of the record
+  /// @return The value of the field, in native byte order
+  ///
+  inline T operator[](std::size_t record) const;
+  ///
+  /// \fn inline T at(std::size_t record) const
+  /// \brief Load the field of a record, with bounds checking.
+  ///
+  /// @param record The index of the record
+  /// @return The value of the field, in native byte order
+  ///
+  inline T at(std::size_t record) const;
+  ///
+  /// \fn void copy(std::size_t first, std::size_t nrRecords, T * output) const
+  /// \brief Load the fields of a block of consecutive records, with bounds checking.
+  ///
+  /// Contiguous fields are converted with the vectorized byteSwap().
+  ///
+  /// @param first The index of the first record
+  /// @param nrRecords The number of records to load
+  /// @param output The array to store the values, in native byte order
+  ///
+  void copy(std::size_t first, std::size_t nrRecords, T * output) const;
+  ///
+  /// \fn inline bool isZeroCopy() const
+  /// \brief Check if the fields can be accessed directly in the mapped memory.
+  ///
+  /// @return True if the fields are contiguous, aligned, and in native byte order
+  ///
+  inline bool isZeroCopy() const;
+  ///
+  /// \fn const T * data() const
+  /// \brief Retrieve a pointer to the fields in the mapped memory.
+  ///
+  /// Only valid if isZeroCopy() is true, otherwise a MappedFileError is thrown.
+  ///
+  /// @return A pointer to the field of the first record, nullptr for an empty view outside of the file
+  ///
+  const T * data() const;
+
+private:
+  const unsigned char * base;
+  std::size_t stride;
+  std::size_t nrRecords;
+  bool swap;
+};
+
+inline const unsigned char * MappedFile::getData() const {
+  return data;
+}
+
+inline std::size_t MappedFile::getSize() const {
+  return size;
+}
+
+inline std::string MappedFile::getPath() const {
+  return path;
+}
+
+template<typename T> RecordView<T>::RecordView(const MappedFile & file, const Endianness endianness, const std::size_t offset, const std::size_t stride, const std::size_t nrRecords) : base(nullptr), stride(stride), nrRecords(nrRecords), swap((endianness != nativeEndianness()) && (sizeof(T) > 1)) {
+  static_assert(std::is_arithmetic<T>::value, "RecordView is only defined for arithmetic types.");
+  if ( stride < sizeof(T) ) {
+    throw MappedFileError("ERROR: stride smaller than the field in \"" + file.getPath() + "\"");
+  }
+  // Written so that large offsets cannot overflow
+  if ( offset > file.getSize() || file.getSize() - offset < sizeof(T) ) {
+    this->nrRecords = 0;
+    if ( nrRecords > 0 ) {
+      throw MappedFileError("ERROR: records outside of \"" + file.getPath() + "\"");
+    }
+    return;
+  }
+  // Only point into the file once the offset is known to be inside it
+  base = file.getData() + offset;
+  std::size_t available = ((file.getSize() - offset - sizeof(T)) / stride) + 1;
+
+  if ( nrRecords == 0 ) {
+    this->nrRecords = available;
+  } else if ( nrRecords > available ) {
+    throw MappedFileError("ERROR: records outside of \"" + file.getPath() + "\"");
+  }
+}
+
+template<typename T> inline std::size_t RecordView<T>::size() const {
+  return nrRecords;
+}
+
+template<typename T> inline T RecordView<T>::operator[](const std::size_t record) const {
+  T value;
+
+  std::memcpy(&value, base + (record * stride), sizeof(T));
+  if ( swap ) {
+    return byteSwap(value);
+  }
+  return value;
+}
+
+template<typename T> inline T RecordView<T>::at(const std::size_t record) const {
+  if ( record >= nrRecords ) {
+    throw MappedFileError("ERROR: record " + std::to_string(record) + " outside of the view");
+  }
+  return (*this)[record];
+}
+
+template<typename T> void RecordView<T>::copy(const std::size_t first, const std::size_t nrRecords, T * output) const {
+  if ( first > this->nrRecords || nrRecords > this->nrRecords - first ) {
+    throw MappedFileError("ERROR: records outside of the view");
+  }
+  if ( nrRecords == 0 ) {
+    return;
+  }
+  if ( stride == sizeof(T) ) {
+    if ( swap ) {
+      byteSwapArray<sizeof(T)>(base + (first * stride), output, nrRecords);
+    } else {
+      std::memcpy(output, base + (first * stride), nrRecords * sizeof(T));
+    }
+    return;
+  }
+  for ( std::size_t record = 0; record < nrRecords; record++ ) {
+    output[record] = (*this)[first + record];
+  }
+}
+
+template<typename T> inline bool RecordView<T>::isZeroCopy() const {
+  return !swap && (stride == sizeof(T)) && ((reinterpret_cast<std::uintptr_t>(base) % alignof(T)) == 0);
+}
+
+template<typename T> const T * RecordView<T>::data() const {
+  if ( !isZeroCopy() ) {
+    throw MappedFileError("ERROR: the view requires conversion and cannot be accessed directly");
+  }
+  return reinterpret_cast<const T *>(base);
+}
+
+} // utils
+} // isa
@@ -0,0 +1,299 @@
+///
+/// \file Metrics.hpp
+/// \brief
+///
+/// Registry of named metrics and background exporter.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <map>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <cinttypes>
+
+#include "Timer.hpp"
+#include "Statistics.hpp"
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \struct MetricSnapshot
+/// \brief Consistent copy of the state of a Timer or Statistics object.
+///
+struct MetricSnapshot {
+  std::uint64_t nrElements = 0;
+  double total = 0.0;
+  double mean = 0.0;
+  double standardDeviation = 0.0;
+  double min = 0.0;
+  double max = 0.0;
+};
+
+///
+/// \class MetricSlot
+/// \brief Single writer, multiple readers container for the published state of a metric.
+///
+/// The slot is protected by a sequence lock: publishing never blocks and never allocates, while readers retry until they observe a consistent state.
+/// Only one thread may publish to a slot.
+///
+class MetricSlot {
+public:
+  ///
+  /// \fn MetricSlot()
+  /// \brief Constructor.
+  ///
+  MetricSlot();
+
+  ///
+  /// \fn inline void publish(const Timer & timer)
+  /// \brief Publish the current state of a timer.
+  ///
+  /// @param timer The timer to publish
+  ///
+  inline void publish(const Timer & timer);
+  ///
+  /// \fn template<typename T> inline void publish(const Statistics<T> & statistics)
+  /// \brief Publish the current state of a statistics object.
+  ///
+  /// @param statistics The running statistics to publish
+  ///
+  template<typename T> inline void publish(const Statistics<T> & statistics);
+  ///
+  /// \fn inline void publish(const MetricSnapshot & snapshot)
+  /// \brief Publish a snapshot.
+  ///
+  /// @param snapshot The snapshot to publish
+  ///
+  inline void publish(const MetricSnapshot & snapshot);
+  ///
+  /// \fn inline MetricSnapshot read() const
+  /// \brief Read the last published state.
+  ///
+  /// @return A consistent copy of the last published state
+  ///
+  inline MetricSnapshot read() const;
+
+private:
+  std::atomic<std::uint64_t> sequence;
+  std::atomic<std::uint64_t> nrElements;
+  std::atomic<double> total;
+  std::atomic<double> mean;
+  std::atomic<double> standardDeviation;
+  std::atomic<double> min;
+  std::atomic<double> max;
+};
+
+///
+/// \class MetricsRegistry
+/// \brief Collection of named metric slots.
+///
+/// Registration takes a lock, publishing to the returned slot does not.
+///
+class MetricsRegistry {
+public:
+  ///
+  /// \fn MetricSlot & getSlot(const std::string & name)
+  /// \brief Retrieve the slot associated with a name, creating it if necessary.
+  ///
+  /// The returned reference stays valid for the whole lifetime of the registry.
+  ///
+  /// @param name The name of the metric
+  /// @return The slot to publish the metric to
+  ///
+  MetricSlot & getSlot(const std::string & name);
+  ///
+  /// \fn std::vector<std::pair<std::string, MetricSnapshot>> snapshot() const
+  /// \brief Read all the registered metrics.
+  ///
+  /// @return Name and last published state of all the registered metrics, sorted by name
+  ///
+  std::vector<std::pair<std::string, MetricSnapshot>> snapshot() const;
+
+private:
+  mutable std::mutex mutex;
+  std::map<std::string, std::unique_ptr<MetricSlot>> slots;
+};
+
+///
+/// \enum MetricsFormat
+/// \brief Output formats supported by the MetricsExporter.
+///
+enum class MetricsFormat {
+  /// One comma separated line per metric and export, appended to the output file; the header is written only to empty files
+  CSV,
+  /// One JSON object per metric and export, appended to the output file
+  JSONLines,
+  /// Prometheus text exposition format, the output file is atomically replaced at every export
+  Prometheus
+};
+
+///
+/// \class MetricsExporter
+/// \brief Background thread that periodically writes the content of a MetricsRegistry to a file.
+///
+class MetricsExporter {
+public:
+  ///
+  /// \fn MetricsExporter(const MetricsRegistry & registry, const std::string & path, MetricsFormat format, std::chrono::milliseconds interval)
+  /// \brief Constructor.
+  ///
+  /// @param registry The registry to export
+  /// @param path The output file
+  /// @param format The output format
+  /// @param interval The time between two exports
+  ///
+  MetricsExporter(const MetricsRegistry & registry, const std::string & path, MetricsFormat format, std::chrono::milliseconds interval);
+  ///
+  /// \fn ~MetricsExporter()
+  /// \brief Destructor, stops the background thread.
+  ///
+  ~MetricsExporter();
+  MetricsExporter(const MetricsExporter &) = delete;
+  MetricsExporter & operator=(const MetricsExporter &) = delete;
+
+  ///
+  /// \fn void start()
+  /// \brief Start the background thread.
+  ///
+  void start();
+  ///
+  /// \fn void stop()
+  /// \brief Stop the background thread, after a final export.
+  ///
+  void stop();
+  ///
+  /// \fn bool exportNow()
+  /// \brief Export the registry from the calling thread.
+  ///
+  /// @return True if the output has been written, false otherwise
+  ///
+  bool exportNow();
+
+  ///
+  /// \fn inline std::uint64_t getNrExports() const
+  /// \brief Retrieve the number of successful exports.
+  ///
+  /// @return The number of successful exports
+  ///
+  inline std::uint64_t getNrExports() const;
+  ///
+  /// \fn inline std::uint64_t getNrErrors() const
+  /// \brief Retrieve the number of failed exports.
+  ///
+  /// @return The number of exports that could not be written
+  ///
+  inline std::uint64_t getNrErrors() const;
+
+private:
+  void run();
+
+  const MetricsRegistry & registry;
+  std::string path;
+  MetricsFormat format;
+  std::chrono::milliseconds interval;
+  std::thread worker;
+  std::mutex mutex;
+  std::condition_variable wakeUp;
+  bool running;
+  std::mutex outputMutex;
+  bool headerWritten;
+  std::atomic<std::uint64_t> nrExports;
+  std::atomic<std::uint64_t> nrErrors;
+};
+
+inline void MetricSlot::publish(const Timer & timer) {
+  MetricSnapshot snapshot;
+
+  snapshot.nrElements = timer.getNrRuns();
+  snapshot.total = timer.getTotalTime();
+  snapshot.mean = timer.getAverageTime();
+  snapshot.standardDeviation = timer.getStandardDeviation();
+  snapshot.min = timer.getMinTime();
+  snapshot.max = timer.getMaxTime();
+  publish(snapshot);
+}
+
+template<typename T> inline void MetricSlot::publish(const Statistics<T> & statistics) {
+  MetricSnapshot snapshot;
+
+  snapshot.nrElements = statistics.getNrElements();
+  snapshot.total = statistics.getMean() * statistics.getNrElements();
+  snapshot.mean = statistics.getMean();
+  snapshot.standardDeviation = statistics.getStandardDeviation();
+  snapshot.min = static_cast<double>(statistics.getMin());
+  snapshot.max = static_cast<double>(statistics.getMax());
+  publish(snapshot);
+}
+
+inline void MetricSlot::publish(const MetricSnapshot & snapshot) {
+  std::uint64_t current = sequence.load(std::memory_order_relaxed);
+
+  // An odd sequence number marks a write in progress
+  sequence.store(current + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  nrElements.store(snapshot.nrElements, std::memory_order_relaxed);
+  total.store(snapshot.total, std::memory_order_relaxed);
+  mean.store(snapshot.mean, std::memory_order_relaxed);
+  standardDeviation.store(snapshot.standardDeviation, std::memory_order_relaxed);
+  min.store(snapshot.min, std::memory_order_relaxed);
+  max.store(snapshot.max, std::memory_order_relaxed);
+  sequence.store(current + 2, std::memory_order_release);
+}
+
+inline MetricSnapshot MetricSlot::read() const {
+  MetricSnapshot snapshot;
+  std::uint64_t before = 0;
+  std::uint64_t after = 0;
+
+  do {
+    before = sequence.load(std::memory_order_acquire);
+    if ( (before & 1) == 1 ) {
+      std::this_thread::yield();
+      continue;
+    }
+    snapshot.nrElements = nrElements.load(std::memory_order_relaxed);
+    snapshot.total = total.load(std::memory_order_relaxed);
+    snapshot.mean = mean.load(std::memory_order_relaxed);
+    snapshot.standardDeviation = standardDeviation.load(std::memory_order_relaxed);
+    snapshot.min = min.load(std::memory_order_relaxed);
+    snapshot.max = max.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    after = sequence.load(std::memory_order_relaxed);
+  } while ( ((before & 1) == 1) || (before != after) );
+
+  return snapshot;
+}
+
+inline std::uint64_t MetricsExporter::getNrExports() const {
+  return nrExports.load();
+}
+
+inline std::uint64_t MetricsExporter::getNrErrors() const {
+  return nrErrors.load();
+}
+
+} // utils
+} // isa
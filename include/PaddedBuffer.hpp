@@ -0,0 +1,459 @@
+///
+/// \file PaddedBuffer.hpp
+/// \brief
+///
+/// AlignedAllocator and PaddedBuffer classes.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <new>
+#include <limits>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <type_traits>
+#include <sys/mman.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "utils.hpp"
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \class AlignedAllocator
+/// \brief Standard library compatible allocator returning memory aligned to Alignment bytes.
+///
+template<typename T, std::size_t Alignment = 64> class AlignedAllocator {
+public:
+  static_assert((Alignment & (Alignment - 1)) == 0, "The alignment must be a power of two.");
+  static_assert(Alignment >= alignof(T), "The alignment must not be smaller than the natural alignment of the type.");
+  using value_type = T;
+  template<typename U> struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  AlignedAllocator() noexcept = default;
+  template<typename U> AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+  ///
+  /// \fn T * allocate(std::size_t nrElements)
+  /// \brief Allocate aligned memory for an array.
+  ///
+  /// @param nrElements The number of elements of the array
+  /// @return A pointer to the uninitialized array
+  ///
+  T * allocate(std::size_t nrElements);
+  ///
+  /// \fn void deallocate(T * pointer, std::size_t nrElements)
+  /// \brief Free memory returned by allocate().
+  ///
+  /// @param pointer The array to free
+  /// @param nrElements The number of elements of the array
+  ///
+  void deallocate(T * pointer, std::size_t nrElements) noexcept;
+};
+
+template<typename T, typename U, std::size_t Alignment> inline bool operator==(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &) noexcept {
+  return true;
+}
+
+template<typename T, typename U, std::size_t Alignment> inline bool operator!=(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &) noexcept {
+  return false;
+}
+
+///
+/// \struct BufferOptions
+/// \brief Placement options for a PaddedBuffer.
+///
+struct BufferOptions {
+  /// Align the buffer to 2 MiB and ask the kernel to back it with transparent huge pages
+  bool hugePages = false;
+  /// Number of threads zeroing the buffer, so that with a first-touch NUMA policy pages are spread like the rows processed by the same number of workers; zero uses the calling thread
+  unsigned int nrThreads = 0;
+  /// CPUs the zeroing threads are pinned to, thread i on CPU cpus[i % cpus.size()]; if empty, thread i runs on the i-th CPU of the affinity mask of the constructing thread, the CPU a TaskPool with pinned workers uses for worker i > 0 (its worker 0 is the unpinned thread calling parallelFor(), so rows of thread 0 are only local to it if that thread runs on the first CPU of the mask)
+  std::vector<unsigned int> cpus;
+};
+
+///
+/// \fn template<typename T> constexpr std::size_t getCacheLinePadding()
+/// \brief Compute the smallest number of elements whose size is a multiple of a 64 bytes cache line.
+///
+/// @return The number of elements
+///
+template<typename T> constexpr std::size_t getCacheLinePadding();
+
+///
+/// \class PaddedBuffer
+/// \brief Aligned 1D, 2D or 3D array, with every row padded to a multiple of Padding elements.
+///
+/// With the default parameters every row starts on a cache line boundary.
+///
+template<typename T, std::size_t Padding = getCacheLinePadding<T>(), std::size_t Alignment = 64> class PaddedBuffer {
+public:
+  static_assert(std::is_trivially_copyable<T>::value, "PaddedBuffer is only defined for trivially copyable types.");
+  static_assert(Padding > 0, "The padding factor must be larger than zero.");
+  static_assert((Alignment & (Alignment - 1)) == 0, "The alignment must be a power of two.");
+
+  ///
+  /// \fn explicit PaddedBuffer(std::size_t width, std::size_t height = 1, std::size_t depth = 1, const BufferOptions & options = BufferOptions())
+  /// \brief Constructor, allocates and zeroes the buffer.
+  ///
+  /// @param width The number of elements in a row, excluding padding
+  /// @param height The number of rows in a plane
+  /// @param depth The number of planes
+  /// @param options Placement options
+  ///
+  explicit PaddedBuffer(std::size_t width, std::size_t height = 1, std::size_t depth = 1, const BufferOptions & options = BufferOptions());
+  ///
+  /// \fn ~PaddedBuffer()
+  /// \brief Destructor, frees the buffer.
+  ///
+  ~PaddedBuffer();
+  PaddedBuffer(const PaddedBuffer &) = delete;
+  PaddedBuffer & operator=(const PaddedBuffer &) = delete;
+  ///
+  /// \fn PaddedBuffer(PaddedBuffer && other)
+  /// \brief Move constructor.
+  ///
+  /// @param other The buffer to take ownership of
+  ///
+  PaddedBuffer(PaddedBuffer && other) noexcept;
+
+  ///
+  /// \fn static constexpr std::size_t getPitch(std::size_t width)
+  /// \brief Compute the padded length of a row.
+  ///
+  /// @param width The number of elements in a row
+  /// @return The number of elements in a padded row
+  ///
+  static constexpr std::size_t getPitch(std::size_t width);
+  ///
+  /// \fn static constexpr bool hasAlignedRows()
+  /// \brief Check if every row, and not only the first one, is aligned.
+  ///
+  /// @return True if the padded row length is a multiple of the alignment
+  ///
+  static constexpr bool hasAlignedRows();
+
+  ///
+  /// \fn inline T * data()
+  /// \brief Retrieve the first element of the buffer.
+  ///
+  /// @return A pointer to the buffer
+  ///
+  inline T * data();
+  ///
+  /// \fn inline const T * data() const
+  /// \brief Retrieve the first element of the buffer.
+  ///
+  /// @return A pointer to the buffer
+  ///
+  inline const T * data() const;
+  ///
+  /// \fn inline T * getRow(std::size_t y, std::size_t z = 0)
+  /// \brief Retrieve the first element of a row.
+  ///
+  /// @param y The row in the plane
+  /// @param z The plane
+  /// @return A pointer to the row
+  ///
+  inline T * getRow(std::size_t y, std::size_t z = 0);
+  ///
+  /// \fn inline const T * getRow(std::size_t y, std::size_t z = 0) const
+  /// \brief Retrieve the first element of a row.
+  ///
+  /// @param y The row in the plane
+  /// @param z The plane
+  /// @return A pointer to the row
+  ///
+  inline const T * getRow(std::size_t y, std::size_t z = 0) const;
+  ///
+  /// \fn inline T & operator()(std::size_t x, std::size_t y = 0, std::size_t z = 0)
+  /// \brief Access an element.
+  ///
+  /// @param x The element in the row
+  /// @param y The row in the plane
+  /// @param z The plane
+  /// @return A reference to the element
+  ///
+  inline T & operator()(std::size_t x, std::size_t y = 0, std::size_t z = 0);
+  ///
+  /// \fn inline const T & operator()(std::size_t x, std::size_t y = 0, std::size_t z = 0) const
+  /// \brief Access an element.
+  ///
+  /// @param x The element in the row
+  /// @param y The row in the plane
+  /// @param z The plane
+  /// @return A reference to the element
+  ///
+  inline const T & operator()(std::size_t x, std::size_t y = 0, std::size_t z = 0) const;
+  ///
+  /// \fn inline std::size_t getWidth() const
+  /// \brief Retrieve the number of elements in a row, excluding padding.
+  ///
+  /// @return The width of the buffer
+  ///
+  inline std::size_t getWidth() const;
+  ///
+  /// \fn inline std::size_t getHeight() const
+  /// \brief Retrieve the number of rows in a plane.
+  ///
+  /// @return The height of the buffer
+  ///
+  inline std::size_t getHeight() const;
+  ///
+  /// \fn inline std::size_t getDepth() const
+  /// \brief Retrieve the number of planes.
+  ///
+  /// @return The depth of the buffer
+  ///
+  inline std::size_t getDepth() const;
+  ///
+  /// \fn inline std::size_t getPitch() const
+  /// \brief Retrieve the number of elements in a padded row.
+  ///
+  /// @return The pitch of the buffer
+  ///
+  inline std::size_t getPitch() const;
+  ///
+  /// \fn inline std::size_t size() const
+  /// \brief Retrieve the number of elements in the buffer, including padding.
+  ///
+  /// @return The number of elements in the buffer
+  ///
+  inline std::size_t size() const;
+  ///
+  /// \fn inline std::size_t getBytes() const
+  /// \brief Retrieve the size of the buffer, including padding.
+  ///
+  /// @return The size of the buffer in bytes
+  ///
+  inline std::size_t getBytes() const;
+
+private:
+  // Pin the calling thread to the CPU of the index-th first-touch thread; best effort
+  static void pinFirstTouch(unsigned int index, const std::vector<unsigned int> & cpus);
+
+  T * buffer;
+  std::size_t width;
+  std::size_t height;
+  std::size_t depth;
+  std::size_t pitch;
+  std::size_t allocated;
+};
+
+template<typename T> constexpr std::size_t getCacheLinePadding() {
+  // 64 divided by the largest power of two, up to 64, that divides the size of T
+  return 64 / (((sizeof(T) & (~sizeof(T) + 1)) < 64) ? (sizeof(T) & (~sizeof(T) + 1)) : 64);
+}
+
+template<typename T, std::size_t Alignment> T * AlignedAllocator<T, Alignment>::allocate(const std::size_t nrElements) {
+  void * pointer = nullptr;
+
+  if ( nrElements > std::numeric_limits<std::size_t>::max() / sizeof(T) ) {
+    throw std::bad_alloc();
+  }
+  // posix_memalign() requires an alignment that is at least the size of a pointer
+  if ( posix_memalign(&pointer, Alignment < sizeof(void *) ? sizeof(void *) : Alignment, nrElements * sizeof(T)) != 0 ) {
+    throw std::bad_alloc();
+  }
+
+  return static_cast<T *>(pointer);
+}
+
+template<typename T, std::size_t Alignment> void AlignedAllocator<T, Alignment>::deallocate(T * pointer, const std::size_t) noexcept {
+  std::free(pointer);
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> PaddedBuffer<T, Padding, Alignment>::PaddedBuffer(const std::size_t width, const std::size_t height, const std::size_t depth, const BufferOptions & options) : buffer(nullptr), width(width), height(height), depth(depth), pitch(getPitch(width)), allocated(0) {
+  const std::size_t hugePageSize = 2097152;
+  const std::size_t alignment = options.hugePages ? hugePageSize : (Alignment < sizeof(void *) ? sizeof(void *) : Alignment);
+  void * pointer = nullptr;
+
+  allocated = pitch * height * depth * sizeof(T);
+  if ( options.hugePages ) {
+    allocated = pad(allocated, hugePageSize);
+  }
+  if ( allocated == 0 ) {
+    return;
+  }
+  if ( posix_memalign(&pointer, alignment, allocated) != 0 ) {
+    throw std::bad_alloc();
+  }
+  buffer = static_cast<T *>(pointer);
+#ifdef MADV_HUGEPAGE
+  if ( options.hugePages ) {
+    // Only a hint, the buffer is usable even if transparent huge pages are disabled
+    madvise(pointer, allocated, MADV_HUGEPAGE);
+  }
+#endif
+  if ( options.nrThreads <= 1 ) {
+    std::memset(pointer, 0, allocated);
+    return;
+  }
+  // First touch: every thread is pinned, and zeroes a contiguous block of rows, so that its pages are placed on the NUMA node of its CPU
+  const std::size_t nrRows = height * depth;
+  const std::size_t rowsPerThread = (nrRows + options.nrThreads - 1) / options.nrThreads;
+  std::vector<std::thread> threads;
+
+  try {
+    threads.reserve(options.nrThreads);
+    for ( unsigned int thread = 0; thread < options.nrThreads; thread++ ) {
+      std::size_t first = thread * rowsPerThread;
+      std::size_t last = (first + rowsPerThread < nrRows) ? first + rowsPerThread : nrRows;
+
+      if ( first >= last ) {
+        break;
+      }
+      threads.emplace_back([this, first, last, thread, &options]() {
+        pinFirstTouch(thread, options.cpus);
+        std::memset(static_cast<void *>(buffer + (first * pitch)), 0, (last - first) * pitch * sizeof(T));
+      });
+    }
+  } catch ( ... ) {
+    // Not enough resources for the threads: wait for the ones already running, and zero the buffer from the calling thread
+    for ( auto & thread : threads ) {
+      thread.join();
+    }
+    std::memset(pointer, 0, allocated);
+    return;
+  }
+  for ( auto & thread : threads ) {
+    thread.join();
+  }
+  // Padding added for huge pages, after the last row
+  std::size_t used = nrRows * pitch * sizeof(T);
+  std::memset(reinterpret_cast<unsigned char *>(pointer) + used, 0, allocated - used);
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> PaddedBuffer<T, Padding, Alignment>::~PaddedBuffer() {
+  std::free(buffer);
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> PaddedBuffer<T, Padding, Alignment>::PaddedBuffer(PaddedBuffer && other) noexcept : buffer(other.buffer), width(other.width), height(other.height), depth(other.depth), pitch(other.pitch), allocated(other.allocated) {
+  other.buffer = nullptr;
+  other.width = 0;
+  other.height = 0;
+  other.depth = 0;
+  other.allocated = 0;
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> void PaddedBuffer<T, Padding, Alignment>::pinFirstTouch(const unsigned int index, const std::vector<unsigned int> & cpus) {
+#if defined(__linux__)
+  cpu_set_t selected;
+
+  CPU_ZERO(&selected);
+  if ( !cpus.empty() ) {
+    if ( cpus.at(index % cpus.size()) >= CPU_SETSIZE ) {
+      return;
+    }
+    CPU_SET(cpus.at(index % cpus.size()), &selected);
+  } else {
+    cpu_set_t available;
+    unsigned int nrAvailable = 0;
+
+    if ( sched_getaffinity(0, sizeof(available), &available) != 0 ) {
+      return;
+    }
+    nrAvailable = CPU_COUNT(&available);
+    if ( nrAvailable == 0 ) {
+      return;
+    }
+    // The index-th available CPU, wrapping around if there are more threads than CPUs
+    unsigned int target = index % nrAvailable;
+
+    for ( int cpu = 0; cpu < CPU_SETSIZE; cpu++ ) {
+      if ( CPU_ISSET(cpu, &available) ) {
+        if ( target == 0 ) {
+          CPU_SET(cpu, &selected);
+          break;
+        }
+        target--;
+      }
+    }
+  }
+  sched_setaffinity(0, sizeof(selected), &selected);
+#else
+  (void)index;
+  (void)cpus;
+#endif
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> constexpr std::size_t PaddedBuffer<T, Padding, Alignment>::getPitch(const std::size_t width) {
+  return static_cast<std::size_t>(pad<Padding>(width));
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> constexpr bool PaddedBuffer<T, Padding, Alignment>::hasAlignedRows() {
+  return ((Padding * sizeof(T)) % Alignment) == 0;
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline T * PaddedBuffer<T, Padding, Alignment>::data() {
+  return buffer;
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline const T * PaddedBuffer<T, Padding, Alignment>::data() const {
+  return buffer;
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline T * PaddedBuffer<T, Padding, Alignment>::getRow(const std::size_t y, const std::size_t z) {
+  return buffer + (((z * height) + y) * pitch);
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline const T * PaddedBuffer<T, Padding, Alignment>::getRow(const std::size_t y, const std::size_t z) const {
+  return buffer + (((z * height) + y) * pitch);
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline T & PaddedBuffer<T, Padding, Alignment>::operator()(const std::size_t x, const std::size_t y, const std::size_t z) {
+  return getRow(y, z)[x];
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline const T & PaddedBuffer<T, Padding, Alignment>::operator()(const std::size_t x, const std::size_t y, const std::size_t z) const {
+  return getRow(y, z)[x];
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline std::size_t PaddedBuffer<T, Padding, Alignment>::getWidth() const {
+  return width;
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline std::size_t PaddedBuffer<T, Padding, Alignment>::getHeight() const {
+  return height;
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline std::size_t PaddedBuffer<T, Padding, Alignment>::getDepth() const {
+  return depth;
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline std::size_t PaddedBuffer<T, Padding, Alignment>::getPitch() const {
+  return pitch;
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline std::size_t PaddedBuffer<T, Padding, Alignment>::size() const {
+  return pitch * height * depth;
+}
+
+template<typename T, std::size_t Padding, std::size_t Alignment> inline std::size_t PaddedBuffer<T, Padding, Alignment>::getBytes() const {
+  return size() * sizeof(T);
+}
+
+} // utils
+} // isa
@@ -0,0 +1,120 @@
+///
+/// \file SPSCQueue.hpp
+/// \brief
+///
+/// SPSCQueue class.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \class SPSCQueue
+/// \brief Bounded lock-free queue with a single producer and a single consumer.
+///
+/// Items are copied in and out of a ring buffer; the capacity is rounded up to a power of two.
+///
+template<typename T> class SPSCQueue {
+public:
+  ///
+  /// \fn explicit SPSCQueue(std::size_t capacity)
+  /// \brief Constructor.
+  ///
+  /// @param capacity The minimum number of items the queue can hold
+  ///
+  explicit SPSCQueue(std::size_t capacity);
+  SPSCQueue(const SPSCQueue &) = delete;
+  SPSCQueue & operator=(const SPSCQueue &) = delete;
+
+  ///
+  /// \fn inline bool tryPush(const T & item)
+  /// \brief Append an item to the queue, if there is space. Only to be called by the producer.
+  ///
+  /// @param item The item to append
+  /// @return True if the item has been appended, false if the queue is full
+  ///
+  inline bool tryPush(const T & item);
+  ///
+  /// \fn inline bool tryPop(T & item)
+  /// \brief Remove the oldest item from the queue, if any. Only to be called by the consumer.
+  ///
+  /// @param item The removed item
+  /// @return True if an item has been removed, false if the queue is empty
+  ///
+  inline bool tryPop(T & item);
+  ///
+  /// \fn inline std::size_t getCapacity() const
+  /// \brief Retrieve the number of items the queue can hold.
+  ///
+  /// @return The capacity of the queue
+  ///
+  inline std::size_t getCapacity() const;
+
+private:
+  std::vector<T> items;
+  std::size_t mask;
+  // Producer and consumer indices on different cache lines, to avoid false sharing
+  alignas(64) std::atomic<std::size_t> head;
+  alignas(64) std::atomic<std::size_t> tail;
+};
+
+template<typename T> SPSCQueue<T>::SPSCQueue(const std::size_t capacity) : mask(0), head(0), tail(0) {
+  std::size_t size = 1;
+
+  while ( size < capacity ) {
+    size <<= 1;
+  }
+  items.resize(size);
+  mask = size - 1;
+}
+
+template<typename T> inline bool SPSCQueue<T>::tryPush(const T & item) {
+  std::size_t currentTail = tail.load(std::memory_order_relaxed);
+
+  if ( currentTail - head.load(std::memory_order_acquire) == items.size() ) {
+    return false;
+  }
+  items[currentTail & mask] = item;
+  tail.store(currentTail + 1, std::memory_order_release);
+
+  return true;
+}
+
+template<typename T> inline bool SPSCQueue<T>::tryPop(T & item) {
+  std::size_t currentHead = head.load(std::memory_order_relaxed);
+
+  if ( currentHead == tail.load(std::memory_order_acquire) ) {
+    return false;
+  }
+  item = items[currentHead & mask];
+  head.store(currentHead + 1, std::memory_order_release);
+
+  return true;
+}
+
+template<typename T> inline std::size_t SPSCQueue<T>::getCapacity() const {
+  return items.size();
+}
+
+} // utils
+} // isa
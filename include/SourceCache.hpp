@@ -0,0 +1,373 @@
+///
+/// \file SourceCache.hpp
+/// \brief
+///
+/// SourceCache class, memoization of the sources generated from templates, and related error types.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <exception>
+#include <unordered_map>
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \class SourceCacheError
+/// \extends std::exception
+/// \brief Represents the failure to set up the on-disk tier of a SourceCache.
+///
+class SourceCacheError : public std::exception {
+public:
+  ///
+  /// \fn explicit SourceCacheError(const std::string & message)
+  /// \brief Constructor.
+  ///
+  /// @param message The explanation of the error
+  ///
+  explicit SourceCacheError(const std::string & message);
+
+  ///
+  /// \fn const char * what() const
+  /// \brief Provides the error message that explains the exception.
+  ///
+  /// @return A string containing the explanation for the raised exception
+  ///
+  const char * what() const noexcept override;
+
+private:
+  std::string errorMessage;
+};
+
+///
+/// \brief Ordered list of (placeholder, value) pairs, applied to a template one after the other.
+///
+using Substitutions = std::vector<std::pair<std::string, std::string>>;
+
+///
+/// \struct SourceKey
+/// \brief 128 bits FNV-1a hash of a template and its substitutions.
+///
+struct SourceKey {
+  std::uint64_t high = 0;
+  std::uint64_t low = 0;
+
+  ///
+  /// \fn bool operator==(const SourceKey & other) const
+  /// \brief Compare two keys.
+  ///
+  /// @param other The key to compare with
+  /// @return True if the two keys are the same, false otherwise
+  ///
+  bool operator==(const SourceKey & other) const;
+  ///
+  /// \fn bool operator!=(const SourceKey & other) const
+  /// \brief Compare two keys.
+  ///
+  /// @param other The key to compare with
+  /// @return True if the two keys are different, false otherwise
+  ///
+  bool operator!=(const SourceKey & other) const;
+  ///
+  /// \fn std::string toString() const
+  /// \brief Represent the key as 32 hexadecimal digits, used as the name of the file in the on-disk tier.
+  ///
+  /// @return The hexadecimal representation of the key
+  ///
+  std::string toString() const;
+};
+
+///
+/// \struct SourceKeyHash
+/// \brief Hash function for SourceKey, to use it in unordered containers.
+///
+struct SourceKeyHash {
+  std::size_t operator()(const SourceKey & key) const;
+};
+
+///
+/// \fn SourceKey hashTemplate(const std::string & sourceTemplate)
+/// \brief Compute the key of a template, without substitutions.
+///
+/// @param sourceTemplate The template
+/// @return The key
+///
+SourceKey hashTemplate(const std::string & sourceTemplate);
+///
+/// \fn SourceKey hashSource(const SourceKey & templateKey, const Substitutions & substitutions)
+/// \brief Compute the key of a template and its substitutions, continuing from the key of the template.
+///
+/// Every string is hashed together with its length, so that moving characters between placeholder and value, or between
+/// template and substitutions, generates a different key; the order of the substitutions is part of the key.
+///
+/// @param templateKey The key of the template, as returned by hashTemplate()
+/// @param substitutions The substitutions to apply to the template
+/// @return The key
+///
+SourceKey hashSource(const SourceKey & templateKey, const Substitutions & substitutions);
+///
+/// \fn SourceKey hashSource(const std::string & sourceTemplate, const Substitutions & substitutions)
+/// \brief Compute the key of a template and its substitutions.
+///
+/// @param sourceTemplate The template
+/// @param substitutions The substitutions to apply to the template
+/// @return The key
+///
+SourceKey hashSource(const std::string & sourceTemplate, const Substitutions & substitutions);
+///
+/// \fn std::string render(const std::string & sourceTemplate, const Substitutions & substitutions)
+/// \brief Apply the substitutions to a template, one after the other, without caching.
+///
+/// The result is the same as a chain of replace() calls, one per substitution.
+///
+/// @param sourceTemplate The template
+/// @param substitutions The substitutions to apply to the template
+/// @return The generated source
+///
+std::string render(const std::string & sourceTemplate, const Substitutions & substitutions);
+
+///
+/// \class SourceTemplate
+/// \brief A template together with its precomputed key.
+///
+/// Hashing a long template costs about as much as rendering it, so templates that are used for many lookups should be
+/// wrapped in a SourceTemplate, and only the substitutions are hashed at every lookup.
+///
+class SourceTemplate {
+public:
+  ///
+  /// \fn explicit SourceTemplate(std::string source)
+  /// \brief Constructor.
+  ///
+  /// @param source The template
+  ///
+  explicit SourceTemplate(std::string source);
+
+  ///
+  /// \fn const std::string & getSource() const
+  /// \brief Retrieve the template.
+  ///
+  /// @return The template
+  ///
+  inline const std::string & getSource() const;
+  ///
+  /// \fn const SourceKey & getKey() const
+  /// \brief Retrieve the key of the template.
+  ///
+  /// @return The key of the template, as returned by hashTemplate()
+  ///
+  inline const SourceKey & getKey() const;
+
+private:
+  std::string source;
+  SourceKey key;
+};
+
+///
+/// \class SourceCache
+/// \brief Content addressed cache of the sources generated from templates.
+///
+/// The sources are indexed by the hash of their template and substitutions. The in-memory tier is a LRU cache, split in
+/// independently locked shards so that concurrent threads rarely contend. The optional on-disk tier stores every generated
+/// source as a file named after its key; files are written to a temporary name and renamed, so concurrent processes
+/// sharing the directory either see a complete file or no file at all.
+///
+class SourceCache {
+public:
+  ///
+  /// \fn SourceCache(std::size_t capacity = 1024, const std::string & directory = std::string(), unsigned int nrShards = 16)
+  /// \brief Constructor.
+  ///
+  /// @param capacity The maximum number of sources kept in memory
+  /// @param directory The directory of the on-disk tier, created if it does not exist; empty to disable the on-disk tier
+  /// @param nrShards The number of independently locked shards of the in-memory tier
+  ///
+  /// Every shard holds at most capacity / nrShards sources, so with many shards evictions can start before the cache is full.
+  ///
+  explicit SourceCache(std::size_t capacity = 1024, const std::string & directory = std::string(), unsigned int nrShards = 16);
+
+  ///
+  /// \fn std::shared_ptr<const std::string> get(const std::string & sourceTemplate, const Substitutions & substitutions)
+  /// \brief Retrieve the source generated from a template, generating it only if it is not cached.
+  ///
+  /// This method is thread safe. The returned source stays valid after it is evicted from the cache.
+  ///
+  /// @param sourceTemplate The template
+  /// @param substitutions The substitutions to apply to the template
+  /// @return The generated source
+  ///
+  std::shared_ptr<const std::string> get(const std::string & sourceTemplate, const Substitutions & substitutions);
+  ///
+  /// \fn std::shared_ptr<const std::string> get(const SourceTemplate & sourceTemplate, const Substitutions & substitutions)
+  /// \brief Retrieve the source generated from a template, generating it only if it is not cached.
+  ///
+  /// Same as the previous method, but the template is not hashed again.
+  ///
+  /// @param sourceTemplate The template, with its precomputed key
+  /// @param substitutions The substitutions to apply to the template
+  /// @return The generated source
+  ///
+  std::shared_ptr<const std::string> get(const SourceTemplate & sourceTemplate, const Substitutions & substitutions);
+  ///
+  /// \fn void clear()
+  /// \brief Remove all sources from the in-memory tier; the on-disk tier and the statistics are not modified.
+  ///
+  void clear();
+
+  ///
+  /// \fn std::size_t getCapacity() const
+  /// \brief Retrieve the maximum number of sources kept in memory.
+  ///
+  /// @return The capacity of the in-memory tier
+  ///
+  inline std::size_t getCapacity() const;
+  ///
+  /// \fn std::size_t getNrEntries() const
+  /// \brief Retrieve the number of sources currently kept in memory.
+  ///
+  /// @return The number of sources in the in-memory tier
+  ///
+  std::size_t getNrEntries() const;
+  ///
+  /// \fn std::uint64_t getNrHits() const
+  /// \brief Retrieve the number of lookups served by the in-memory tier.
+  ///
+  /// @return The number of in-memory hits
+  ///
+  inline std::uint64_t getNrHits() const;
+  ///
+  /// \fn std::uint64_t getNrDiskHits() const
+  /// \brief Retrieve the number of lookups served by the on-disk tier.
+  ///
+  /// @return The number of on-disk hits
+  ///
+  inline std::uint64_t getNrDiskHits() const;
+  ///
+  /// \fn std::uint64_t getNrMisses() const
+  /// \brief Retrieve the number of lookups that generated the source.
+  ///
+  /// @return The number of misses
+  ///
+  inline std::uint64_t getNrMisses() const;
+  ///
+  /// \fn std::uint64_t getNrEvictions() const
+  /// \brief Retrieve the number of sources evicted from the in-memory tier.
+  ///
+  /// @return The number of evictions
+  ///
+  inline std::uint64_t getNrEvictions() const;
+  ///
+  /// \fn double getHitRate() const
+  /// \brief Retrieve the fraction of lookups that did not generate the source.
+  ///
+  /// @return The hit rate, between 0 and 1
+  ///
+  inline double getHitRate() const;
+
+private:
+  struct Entry {
+    SourceKey key;
+    std::shared_ptr<const std::string> source;
+  };
+  struct Shard {
+    std::mutex lock;
+    // Most recently used first
+    std::list<Entry> entries;
+    std::unordered_map<SourceKey, std::list<Entry>::iterator, SourceKeyHash> index;
+  };
+
+  std::shared_ptr<const std::string> get(const std::string & sourceTemplate, const SourceKey & key, const Substitutions & substitutions);
+  std::shared_ptr<const std::string> find(Shard & shard, const SourceKey & key);
+  std::shared_ptr<const std::string> insert(Shard & shard, const SourceKey & key, std::shared_ptr<const std::string> source);
+  std::shared_ptr<const std::string> readFile(const SourceKey & key) const;
+  void writeFile(const SourceKey & key, const std::string & source) const;
+
+  std::size_t capacity;
+  std::size_t shardCapacity;
+  std::string directory;
+  std::vector<std::unique_ptr<Shard>> shards;
+  std::atomic<std::uint64_t> nrHits;
+  std::atomic<std::uint64_t> nrDiskHits;
+  std::atomic<std::uint64_t> nrMisses;
+  std::atomic<std::uint64_t> nrEvictions;
+};
+
+
+inline bool SourceKey::operator==(const SourceKey & other) const {
+  return (high == other.high) && (low == other.low);
+}
+
+inline bool SourceKey::operator!=(const SourceKey & other) const {
+  return !(*this == other);
+}
+
+inline std::size_t SourceKeyHash::operator()(const SourceKey & key) const {
+  // The key is already a good hash
+  return static_cast<std::size_t>(key.low ^ key.high);
+}
+
+inline const std::string & SourceTemplate::getSource() const {
+  return source;
+}
+
+inline const SourceKey & SourceTemplate::getKey() const {
+  return key;
+}
+
+inline std::size_t SourceCache::getCapacity() const {
+  return capacity;
+}
+
+inline std::uint64_t SourceCache::getNrHits() const {
+  return nrHits.load(std::memory_order_relaxed);
+}
+
+inline std::uint64_t SourceCache::getNrDiskHits() const {
+  return nrDiskHits.load(std::memory_order_relaxed);
+}
+
+inline std::uint64_t SourceCache::getNrMisses() const {
+  return nrMisses.load(std::memory_order_relaxed);
+}
+
+inline std::uint64_t SourceCache::getNrEvictions() const {
+  return nrEvictions.load(std::memory_order_relaxed);
+}
+
+inline double SourceCache::getHitRate() const {
+  std::uint64_t hits = getNrHits() + getNrDiskHits();
+  std::uint64_t lookups = hits + getNrMisses();
+
+  if ( lookups == 0 ) {
+    return 0.0;
+  }
+  return static_cast<double>(hits) / lookups;
+}
+
+} // utils
+} // isa
+
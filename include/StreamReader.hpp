@@ -0,0 +1,286 @@
+///
+/// \file StreamReader.hpp
+/// \brief
+///
+/// StreamReader class, conversion stages and related error types.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <cstring>
+#include <cstddef>
+#include <cinttypes>
+
+#include "Timer.hpp"
+#include "ByteSwap.hpp"
+#include "SPSCQueue.hpp"
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \class StreamError
+/// \extends std::exception
+/// \brief Represents an error while reading or converting a stream.
+///
+class StreamError : public std::exception {
+public:
+  ///
+  /// \fn explicit StreamError(const std::string & message)
+  /// \brief Constructor.
+  ///
+  /// @param message The explanation of the error
+  ///
+  explicit StreamError(const std::string & message);
+
+  ///
+  /// \fn const char * what() const
+  /// \brief Provides the error message that explains the exception.
+  ///
+  /// @return A string containing the explanation for the raised exception
+  ///
+  const char * what() const noexcept override;
+
+private:
+  std::string errorMessage;
+};
+
+///
+/// \struct StreamBlock
+/// \brief A block of data ready to be consumed.
+///
+struct StreamBlock {
+  /// The converted data
+  unsigned char * data = nullptr;
+  /// The number of valid bytes in data
+  std::size_t size = 0;
+  /// The position in the file of the first byte of the block
+  std::uint64_t offset = 0;
+  /// The sequence number of the block
+  std::uint64_t index = 0;
+  /// The buffer containing the block, to be returned with StreamReader::release()
+  unsigned int buffer = 0;
+};
+
+///
+/// \typedef StreamConversion
+/// \brief In-place conversion stage: receives the data, the number of valid bytes and the size of the buffer, and returns the new number of valid bytes.
+///
+using StreamConversion = std::function<std::size_t(unsigned char * data, std::size_t size, std::size_t capacity)>;
+
+///
+/// \fn template<typename T> StreamConversion byteSwapStage()
+/// \brief Conversion stage that changes the endianness of every element of type T.
+///
+/// A trailing partial element is dropped from the block, so the block size should be a multiple of sizeof(T).
+///
+/// @return The conversion stage
+///
+template<typename T> StreamConversion byteSwapStage();
+///
+/// \fn template<typename In, typename Out> StreamConversion widenStage(Endianness endianness)
+/// \brief Conversion stage that converts, in place, elements of type In stored with a given byte order into native elements of type Out.
+///
+/// The buffers must be at least sizeof(Out) / sizeof(In) times larger than the blocks.
+///
+/// @param endianness The byte order of the elements in the file
+/// @return The conversion stage
+///
+template<typename In, typename Out> StreamConversion widenStage(Endianness endianness);
+
+///
+/// \class StreamReader
+/// \brief Sequential reader that overlaps I/O, conversion and processing.
+///
+/// Blocks are read by a background thread into a pool of rotating buffers, optionally converted by a second thread,
+/// and handed to the consumer; the stages communicate through lock-free queues.
+///
+class StreamReader {
+public:
+  ///
+  /// \fn StreamReader(const std::string & path, std::size_t blockSize, unsigned int nrBuffers = 4, bool directIO = false, std::size_t bufferSize = 0)
+  /// \brief Constructor, opens the file.
+  ///
+  /// @param path The file to read
+  /// @param blockSize The number of bytes read in every block; with direct I/O, a multiple of 4096
+  /// @param nrBuffers The number of rotating buffers
+  /// @param directIO Bypass the page cache with O_DIRECT, falling back to buffered I/O if not supported by the file system
+  /// @param bufferSize The size of each buffer, if larger than blockSize
+  ///
+  StreamReader(const std::string & path, std::size_t blockSize, unsigned int nrBuffers = 4, bool directIO = false, std::size_t bufferSize = 0);
+  ///
+  /// \fn ~StreamReader()
+  /// \brief Destructor, stops the background threads and closes the file.
+  ///
+  ~StreamReader();
+  StreamReader(const StreamReader &) = delete;
+  StreamReader & operator=(const StreamReader &) = delete;
+
+  ///
+  /// \fn void setConversion(const StreamConversion & conversion)
+  /// \brief Set the conversion stage, run on its own thread. Must be called before start().
+  ///
+  /// @param conversion The conversion stage
+  ///
+  void setConversion(const StreamConversion & conversion);
+  ///
+  /// \fn void start()
+  /// \brief Start the background threads.
+  ///
+  void start();
+  ///
+  /// \fn bool next(StreamBlock & block)
+  /// \brief Wait for the next block.
+  ///
+  /// Errors in the background threads are rethrown here.
+  ///
+  /// @param block The next block
+  /// @return True if a block is available, false if the end of the file has been reached
+  ///
+  bool next(StreamBlock & block);
+  ///
+  /// \fn void release(const StreamBlock & block)
+  /// \brief Return the buffer of a consumed block to the reader.
+  ///
+  /// @param block The consumed block
+  ///
+  void release(const StreamBlock & block);
+
+  ///
+  /// \fn inline bool isDirectIO() const
+  /// \brief Check if the file has been opened with O_DIRECT.
+  ///
+  /// @return True if direct I/O is used, false otherwise
+  ///
+  inline bool isDirectIO() const;
+  ///
+  /// \fn inline const Timer & getReadTimer() const
+  /// \brief Retrieve the time spent reading blocks. Only valid after the end of the file has been reached.
+  ///
+  /// @return The timer of the read stage
+  ///
+  inline const Timer & getReadTimer() const;
+  ///
+  /// \fn inline const Timer & getConversionTimer() const
+  /// \brief Retrieve the time spent converting blocks. Only valid after the end of the file has been reached.
+  ///
+  /// @return The timer of the conversion stage
+  ///
+  inline const Timer & getConversionTimer() const;
+  ///
+  /// \fn inline const Timer & getWaitTimer() const
+  /// \brief Retrieve the time the consumer spent waiting for blocks in next().
+  ///
+  /// @return The timer of the consumer waits
+  ///
+  inline const Timer & getWaitTimer() const;
+
+private:
+  void read();
+  void convert();
+  void finish(std::exception_ptr error, SPSCQueue<unsigned int> & output);
+  void stopThreads();
+  // Queue operations that spin for a while, then sleep until another stage makes progress
+  bool push(SPSCQueue<unsigned int> & queue, unsigned int item);
+  bool pop(SPSCQueue<unsigned int> & queue, unsigned int & item);
+  void wakeUp();
+
+  std::string path;
+  int descriptor;
+  bool directIO;
+  std::size_t blockSize;
+  std::size_t bufferSize;
+  std::vector<unsigned char *> buffers;
+  std::vector<StreamBlock> blocks;
+  StreamConversion conversion;
+  SPSCQueue<unsigned int> freeBuffers;
+  SPSCQueue<unsigned int> readBuffers;
+  SPSCQueue<unsigned int> readyBuffers;
+  std::thread reader;
+  std::thread converter;
+  std::atomic<bool> stopping;
+  std::mutex waitMutex;
+  std::condition_variable progress;
+  std::atomic<unsigned int> nrWaiting;
+  std::atomic<bool> errorSet;
+  std::exception_ptr error;
+  bool started;
+  bool finished;
+  Timer readTimer;
+  Timer conversionTimer;
+  Timer waitTimer;
+};
+
+template<typename T> StreamConversion byteSwapStage() {
+  return [](unsigned char * data, const std::size_t size, const std::size_t) -> std::size_t {
+    byteSwapArray<sizeof(T)>(data, data, size / sizeof(T));
+    return size - (size % sizeof(T));
+  };
+}
+
+template<typename In, typename Out> StreamConversion widenStage(const Endianness endianness) {
+  static_assert(sizeof(Out) >= sizeof(In), "widenStage() requires an output type at least as large as the input type.");
+  const bool swap = endianness != nativeEndianness();
+
+  return [swap](unsigned char * data, const std::size_t size, const std::size_t capacity) -> std::size_t {
+    const std::size_t nrElements = size / sizeof(In);
+
+    if ( nrElements * sizeof(Out) > capacity ) {
+      throw StreamError("ERROR: buffers too small for the widening stage");
+    }
+    // Backwards, so that every element is read before being overwritten
+    for ( std::size_t element = nrElements; element > 0; element-- ) {
+      In input;
+      Out output;
+
+      std::memcpy(&input, data + ((element - 1) * sizeof(In)), sizeof(In));
+      if ( swap ) {
+        input = byteSwap(input);
+      }
+      output = static_cast<Out>(input);
+      std::memcpy(data + ((element - 1) * sizeof(Out)), &output, sizeof(Out));
+    }
+    return nrElements * sizeof(Out);
+  };
+}
+
+inline bool StreamReader::isDirectIO() const {
+  return directIO;
+}
+
+inline const Timer & StreamReader::getReadTimer() const {
+  return readTimer;
+}
+
+inline const Timer & StreamReader::getConversionTimer() const {
+  return conversionTimer;
+}
+
+inline const Timer & StreamReader::getWaitTimer() const {
+  return waitTimer;
+}
+
+} // utils
+} // isa
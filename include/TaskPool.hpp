@@ -0,0 +1,349 @@
+///
+/// \file TaskPool.hpp
+/// \brief
+///
+/// TaskPool class, a work stealing pool of threads for parallel loops.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+#include "Timer.hpp"
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \struct WorkerStatistics
+/// \brief Accounting of the work executed by one worker of a TaskPool.
+///
+struct WorkerStatistics {
+  /// Number of chunks of iterations executed
+  std::uint64_t nrTasks = 0;
+  /// Number of loop iterations executed
+  std::uint64_t nrIterations = 0;
+  /// Number of ranges stolen from other workers
+  std::uint64_t nrSteals = 0;
+  /// Time spent executing the loop bodies, in seconds
+  double busyTime = 0.0;
+  /// Time spent inside parallel loops looking for work, in seconds
+  double idleTime = 0.0;
+};
+
+///
+/// \class WorkStealingDeque
+/// \brief Bounded Chase-Lev deque of iteration ranges.
+///
+/// The owner pushes and pops at the bottom, the other workers steal from the top. Items are stored in atomic fields, so that a
+/// thief reading a slot that is being overwritten is not a data race; its read is discarded because its CAS on top fails.
+///
+class WorkStealingDeque {
+public:
+  ///
+  /// \fn WorkStealingDeque()
+  /// \brief Constructor.
+  ///
+  WorkStealingDeque();
+
+  ///
+  /// \fn inline bool push(std::size_t begin, std::size_t end)
+  /// \brief Append a range at the bottom of the deque. Only to be called by the owner.
+  ///
+  /// @param begin The first iteration of the range
+  /// @param end One past the last iteration of the range
+  /// @return True if the range has been appended, false if the deque is full
+  ///
+  inline bool push(std::size_t begin, std::size_t end);
+  ///
+  /// \fn inline bool pop(std::size_t & begin, std::size_t & end)
+  /// \brief Remove the most recent range from the bottom of the deque. Only to be called by the owner.
+  ///
+  /// @param begin The first iteration of the removed range
+  /// @param end One past the last iteration of the removed range
+  /// @return True if a range has been removed, false if the deque is empty
+  ///
+  inline bool pop(std::size_t & begin, std::size_t & end);
+  ///
+  /// \fn inline bool steal(std::size_t & begin, std::size_t & end)
+  /// \brief Remove the oldest range from the top of the deque. Can be called by any thread.
+  ///
+  /// @param begin The first iteration of the removed range
+  /// @param end One past the last iteration of the removed range
+  /// @return True if a range has been removed, false if the deque is empty or another thread won the race
+  ///
+  inline bool steal(std::size_t & begin, std::size_t & end);
+  ///
+  /// \fn inline bool empty() const
+  /// \brief Check if the deque is empty. Only exact when called by the owner.
+  ///
+  /// @return True if the deque is empty, false otherwise
+  ///
+  inline bool empty() const;
+
+  /// The maximum number of ranges in the deque; with lazy splitting the owner rarely holds more than one
+  static const std::int64_t capacity = 64;
+
+private:
+  struct Slot {
+    std::atomic<std::size_t> begin;
+    std::atomic<std::size_t> end;
+  };
+
+  Slot slots[capacity];
+  // Thieves and owner indices on different cache lines, to avoid false sharing
+  alignas(64) std::atomic<std::int64_t> top;
+  alignas(64) std::atomic<std::int64_t> bottom;
+};
+
+///
+/// \class TaskPool
+/// \brief Persistent pool of worker threads, executing parallel loops with work stealing.
+///
+/// The thread calling parallelFor() participates as worker 0, the other workers are threads sleeping between loops.
+/// The iterations are initially divided in contiguous blocks, one per worker. Ranges are split lazily: a worker splits its range
+/// in two halves, exposing one of them to thieves, only when its own deque is empty; otherwise it executes chunks of grain size
+/// iterations. Idle workers steal from random victims, so load imbalance is corrected without central coordination.
+///
+/// Every worker times the chunks it executes with its own Timer, and keeps busy, idle and steal accounting; the statistics are
+/// only to be read between parallel loops.
+///
+class TaskPool {
+public:
+  ///
+  /// \fn explicit TaskPool(unsigned int nrWorkers = 0, bool pinWorkers = false)
+  /// \brief Constructor.
+  ///
+  /// @param nrWorkers The number of workers, including the calling thread; zero for the number of hardware threads
+  /// @param pinWorkers Pin worker i, for i > 0, to the i-th CPU in the affinity mask of the process (Linux only)
+  ///
+  explicit TaskPool(unsigned int nrWorkers = 0, bool pinWorkers = false);
+  ///
+  /// \fn ~TaskPool()
+  /// \brief Destructor, stops and joins the workers.
+  ///
+  ~TaskPool();
+  TaskPool(const TaskPool &) = delete;
+  TaskPool & operator=(const TaskPool &) = delete;
+
+  ///
+  /// \fn void parallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t, unsigned int)> & body, std::size_t grainSize = 0)
+  /// \brief Execute body over the iterations [begin, end), in parallel, and wait for its completion.
+  ///
+  /// The body is called with a range of iterations [first, last) and the index of the worker executing it, that can be used
+  /// to index per-worker data without locks. If the body throws, the remaining chunks are skipped, and the first exception is
+  /// rethrown to the caller. Calls from inside a body are executed serially by the calling worker; calls from different
+  /// threads are serialized.
+  ///
+  /// @param begin The first iteration
+  /// @param end One past the last iteration
+  /// @param body The function to execute
+  /// @param grainSize The number of iterations per call of body; zero to derive it from the number of iterations and workers
+  ///
+  void parallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t, unsigned int)> & body, std::size_t grainSize = 0);
+  ///
+  /// \fn void parallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t)> & body, std::size_t grainSize = 0)
+  /// \brief Execute body over the iterations [begin, end), in parallel, and wait for its completion.
+  ///
+  /// Same as the previous method, for bodies that do not need the index of the worker.
+  ///
+  /// @param begin The first iteration
+  /// @param end One past the last iteration
+  /// @param body The function to execute
+  /// @param grainSize The number of iterations per call of body; zero to derive it from the number of iterations and workers
+  ///
+  void parallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t)> & body, std::size_t grainSize = 0);
+
+  ///
+  /// \fn inline unsigned int getNrWorkers() const
+  /// \brief Retrieve the number of workers, including the calling thread.
+  ///
+  /// @return The number of workers
+  ///
+  inline unsigned int getNrWorkers() const;
+  ///
+  /// \fn inline unsigned int getNrPinnedWorkers() const
+  /// \brief Retrieve the number of workers successfully pinned to a CPU.
+  ///
+  /// @return The number of pinned workers
+  ///
+  inline unsigned int getNrPinnedWorkers() const;
+  ///
+  /// \fn inline const WorkerStatistics & getStatistics(unsigned int worker) const
+  /// \brief Retrieve the accounting of one worker.
+  ///
+  /// @param worker The index of the worker
+  /// @return The statistics of the worker
+  ///
+  inline const WorkerStatistics & getStatistics(unsigned int worker) const;
+  ///
+  /// \fn inline const Timer & getTimer(unsigned int worker) const
+  /// \brief Retrieve the timer of one worker, measuring every chunk of iterations it executed.
+  ///
+  /// @param worker The index of the worker
+  /// @return The timer of the worker
+  ///
+  inline const Timer & getTimer(unsigned int worker) const;
+  ///
+  /// \fn WorkerStatistics getTotalStatistics() const
+  /// \brief Retrieve the accounting of all workers, merged.
+  ///
+  /// @return The sum of the statistics of all workers
+  ///
+  WorkerStatistics getTotalStatistics() const;
+  ///
+  /// \fn double getImbalance() const
+  /// \brief Retrieve the load imbalance between the workers.
+  ///
+  /// The imbalance is defined as the maximum busy time divided by the average busy time; 1 means perfectly balanced.
+  ///
+  /// @return The load imbalance
+  ///
+  double getImbalance() const;
+  ///
+  /// \fn void resetStatistics()
+  /// \brief Reset the statistics and timers of all workers.
+  ///
+  void resetStatistics();
+
+private:
+  struct Worker {
+    // The deque is aligned to cache lines, and operator new is not required to honor that before C++17
+    static void * operator new(std::size_t size);
+    static void operator delete(void * pointer);
+
+    WorkStealingDeque deque;
+    Timer timer;
+    WorkerStatistics statistics;
+    std::uint64_t random;
+    std::thread thread;
+  };
+
+  void run(unsigned int worker);
+  void work(unsigned int worker);
+  void execute(unsigned int worker, std::size_t begin, std::size_t end);
+  bool steal(unsigned int worker, std::size_t & begin, std::size_t & end);
+
+  std::vector<std::unique_ptr<Worker>> workers;
+  unsigned int nrPinnedWorkers;
+  // Serializes parallel loops issued by different threads
+  std::mutex loopMutex;
+  // Workers sleep on wakeUp between loops, waiting for a new generation
+  std::mutex sleepMutex;
+  std::condition_variable wakeUp;
+  std::atomic<std::uint64_t> generation;
+  bool stopping;
+  // State of the current loop
+  const std::function<void(std::size_t, std::size_t, unsigned int)> * body;
+  std::size_t grainSize;
+  std::atomic<std::size_t> nrRemaining;
+  std::atomic<unsigned int> nrFinished;
+  std::atomic<bool> cancelled;
+  std::mutex errorMutex;
+  std::exception_ptr error;
+};
+
+
+inline bool WorkStealingDeque::push(const std::size_t begin, const std::size_t end) {
+  std::int64_t currentBottom = bottom.load(std::memory_order_relaxed);
+
+  if ( currentBottom - top.load(std::memory_order_acquire) >= capacity ) {
+    return false;
+  }
+  Slot & slot = slots[currentBottom & (capacity - 1)];
+
+  slot.begin.store(begin, std::memory_order_relaxed);
+  slot.end.store(end, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  bottom.store(currentBottom + 1, std::memory_order_relaxed);
+
+  return true;
+}
+
+inline bool WorkStealingDeque::pop(std::size_t & begin, std::size_t & end) {
+  std::int64_t currentBottom = bottom.load(std::memory_order_relaxed) - 1;
+
+  bottom.store(currentBottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t currentTop = top.load(std::memory_order_relaxed);
+
+  if ( currentTop > currentBottom ) {
+    bottom.store(currentBottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+  Slot & slot = slots[currentBottom & (capacity - 1)];
+
+  begin = slot.begin.load(std::memory_order_relaxed);
+  end = slot.end.load(std::memory_order_relaxed);
+  if ( currentTop == currentBottom ) {
+    // Last range: race with the thieves
+    bool won = top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+    bottom.store(currentBottom + 1, std::memory_order_relaxed);
+    return won;
+  }
+
+  return true;
+}
+
+inline bool WorkStealingDeque::steal(std::size_t & begin, std::size_t & end) {
+  std::int64_t currentTop = top.load(std::memory_order_acquire);
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if ( currentTop >= bottom.load(std::memory_order_acquire) ) {
+    return false;
+  }
+  Slot & slot = slots[currentTop & (capacity - 1)];
+
+  begin = slot.begin.load(std::memory_order_relaxed);
+  end = slot.end.load(std::memory_order_relaxed);
+
+  return top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+}
+
+inline bool WorkStealingDeque::empty() const {
+  return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+}
+
+inline unsigned int TaskPool::getNrWorkers() const {
+  return static_cast<unsigned int>(workers.size());
+}
+
+inline unsigned int TaskPool::getNrPinnedWorkers() const {
+  return nrPinnedWorkers;
+}
+
+inline const WorkerStatistics & TaskPool::getStatistics(const unsigned int worker) const {
+  return workers.at(worker)->statistics;
+}
+
+inline const Timer & TaskPool::getTimer(const unsigned int worker) const {
+  return workers.at(worker)->timer;
+}
+
+} // utils
+} // isa
+
@@ -0,0 +1,342 @@
+///
+/// \file Throughput.hpp
+/// \brief
+///
+/// Throughput class, machine model and roofline reporting.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <cstddef>
+#include <cinttypes>
+
+#include "Timer.hpp"
+#include "Statistics.hpp"
+#include "utils.hpp"
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+///
+/// \class MachineModel
+/// \brief Peak compute and memory capabilities of a machine, as used by the roofline model.
+///
+class MachineModel {
+public:
+  ///
+  /// \fn MachineModel(double peakOperations, double peakBandwidth)
+  /// \brief Constructor.
+  ///
+  /// @param peakOperations The peak number of operations per second
+  /// @param peakBandwidth The peak number of bytes per second
+  ///
+  MachineModel(double peakOperations, double peakBandwidth);
+
+  ///
+  /// \fn inline double getPeakOperations() const
+  /// \brief Retrieve the peak number of operations per second.
+  ///
+  /// @return The peak number of operations per second
+  ///
+  inline double getPeakOperations() const;
+  ///
+  /// \fn inline double getPeakBandwidth() const
+  /// \brief Retrieve the peak number of bytes per second.
+  ///
+  /// @return The peak number of bytes per second
+  ///
+  inline double getPeakBandwidth() const;
+  ///
+  /// \fn inline double getRidgePoint() const
+  /// \brief Retrieve the arithmetic intensity where the roofline changes from memory to compute bound.
+  ///
+  /// @return The arithmetic intensity, in operations per byte, of the ridge point
+  ///
+  inline double getRidgePoint() const;
+  ///
+  /// \fn inline double getAttainableOperations(double intensity) const
+  /// \brief Retrieve the roofline, i.e. the maximum attainable operations per second, for a given arithmetic intensity.
+  ///
+  /// @param intensity The arithmetic intensity, in operations per byte
+  /// @return The maximum attainable number of operations per second
+  ///
+  inline double getAttainableOperations(double intensity) const;
+
+private:
+  double peakOperations;
+  double peakBandwidth;
+};
+
+///
+/// \fn double measureBandwidth(std::size_t nrElements = 16777216, unsigned int nrIterations = 10)
+/// \brief Measure the sustainable memory bandwidth of a single thread with a STREAM-like triad kernel.
+///
+/// One core usually cannot saturate the memory controllers, so this is a lower bound of the bandwidth of the whole machine.
+///
+/// @param nrElements The number of double precision elements in each of the three arrays
+/// @param nrIterations The number of times the kernel is executed; the best run is used
+/// @return The measured bandwidth, in bytes per second
+///
+double measureBandwidth(std::size_t nrElements = 16777216, unsigned int nrIterations = 10);
+///
+/// \fn double measurePeakOperations(std::uint64_t nrIterations = 67108864)
+/// \brief Measure the single core, scalar, floating point throughput with independent multiply-add chains.
+///
+/// Vector units and the other cores are not used, so this is a lower bound of the peak of the whole machine.
+///
+/// @param nrIterations The number of iterations of the kernel
+/// @return The measured number of floating point operations per second
+///
+double measurePeakOperations(std::uint64_t nrIterations = 67108864);
+///
+/// \fn MachineModel measureMachineModel()
+/// \brief Build a single core, scalar, machine model from measureBandwidth() and measurePeakOperations().
+///
+/// This is the ceiling of a scalar kernel running on one thread; vectorized or multi-threaded kernels can go above 100% of
+/// this roofline, and should be compared with a MachineModel built from the peak values of the whole machine instead.
+///
+/// @return The measured machine model
+///
+MachineModel measureMachineModel();
+
+///
+/// \class Throughput
+/// \brief Timer with attached operation and byte counts.
+///
+/// Every timed interval is converted into operations per second and bytes per second, and running statistics are kept for both.
+///
+class Throughput {
+public:
+  ///
+  /// \fn Throughput(std::uint64_t operations = 0, std::uint64_t bytes = 0)
+  /// \brief Constructor.
+  ///
+  /// @param operations The number of operations performed in every timed interval
+  /// @param bytes The number of bytes moved in every timed interval
+  ///
+  explicit Throughput(std::uint64_t operations = 0, std::uint64_t bytes = 0);
+
+  ///
+  /// \fn inline void start()
+  /// \brief Start the timer.
+  ///
+  inline void start();
+  ///
+  /// \fn inline void stop()
+  /// \brief Stop the timer, accounting for the default operation and byte counts.
+  ///
+  inline void stop();
+  ///
+  /// \fn inline void stop(std::uint64_t operations, std::uint64_t bytes)
+  /// \brief Stop the timer, accounting for the provided operation and byte counts.
+  ///
+  /// @param operations The number of operations performed in this interval
+  /// @param bytes The number of bytes moved in this interval
+  ///
+  inline void stop(std::uint64_t operations, std::uint64_t bytes);
+  ///
+  /// \fn void addRun(double seconds, std::uint64_t operations, std::uint64_t bytes)
+  /// \brief Account for an interval that has been measured elsewhere, e.g. with Timer::getLastRunTime().
+  ///
+  /// Intervals shorter than the resolution of the clock, including zero length ones, are accounted as lasting one clock tick.
+  ///
+  /// @param seconds The duration of the interval, in seconds
+  /// @param operations The number of operations performed in this interval
+  /// @param bytes The number of bytes moved in this interval
+  ///
+  void addRun(double seconds, std::uint64_t operations, std::uint64_t bytes);
+  ///
+  /// \fn void reset()
+  /// \brief Reset the internal state, deleting all measured intervals.
+  ///
+  void reset();
+
+  ///
+  /// \fn inline const Timer & getTimer() const
+  /// \brief Retrieve the underlying timer.
+  ///
+  /// @return The timer used to measure the intervals
+  ///
+  inline const Timer & getTimer() const;
+  ///
+  /// \fn inline std::uint64_t getNrRuns() const
+  /// \brief Retrieve the number of accounted intervals, timed or added with addRun().
+  ///
+  /// @return The number of intervals
+  ///
+  inline std::uint64_t getNrRuns() const;
+  ///
+  /// \fn inline double getOperationsPerSecond() const
+  /// \brief Retrieve the mean number of operations per second.
+  ///
+  /// @return The mean of the operations per second of all intervals
+  ///
+  inline double getOperationsPerSecond() const;
+  ///
+  /// \fn inline double getOperationsPerSecondStandardDeviation() const
+  /// \brief Retrieve the standard deviation of the operations per second.
+  ///
+  /// @return The standard deviation of the operations per second of all intervals
+  ///
+  inline double getOperationsPerSecondStandardDeviation() const;
+  ///
+  /// \fn inline double getBytesPerSecond() const
+  /// \brief Retrieve the mean number of bytes per second.
+  ///
+  /// @return The mean of the bytes per second of all intervals
+  ///
+  inline double getBytesPerSecond() const;
+  ///
+  /// \fn inline double getBytesPerSecondStandardDeviation() const
+  /// \brief Retrieve the standard deviation of the bytes per second.
+  ///
+  /// @return The standard deviation of the bytes per second of all intervals
+  ///
+  inline double getBytesPerSecondStandardDeviation() const;
+  ///
+  /// \fn inline double getArithmeticIntensity() const
+  /// \brief Retrieve the arithmetic intensity, i.e. the total operations divided by the total bytes.
+  ///
+  /// @return The number of operations per byte, or zero if no bytes have been accounted for
+  ///
+  inline double getArithmeticIntensity() const;
+  ///
+  /// \fn double getRooflinePercentage(const MachineModel & machine) const
+  /// \brief Retrieve the percentage of the attainable performance achieved on a machine.
+  ///
+  /// @param machine The model of the machine the intervals were measured on
+  /// @return The mean operations per second as percentage of the roofline at the measured arithmetic intensity
+  ///
+  double getRooflinePercentage(const MachineModel & machine) const;
+  ///
+  /// \fn inline bool isAboveRoofline(const MachineModel & machine) const
+  /// \brief Check if the measured performance is above the roofline, i.e. the machine model underestimates the machine.
+  ///
+  /// @param machine The model of the machine the intervals were measured on
+  /// @return True if more than 100% of the roofline has been achieved, false otherwise
+  ///
+  inline bool isAboveRoofline(const MachineModel & machine) const;
+  ///
+  /// \fn inline bool isMemoryBound(const MachineModel & machine) const
+  /// \brief Check if the measured arithmetic intensity is on the memory bound side of the ridge point.
+  ///
+  /// @param machine The model of the machine the intervals were measured on
+  /// @return True if memory bound, false if compute bound
+  ///
+  inline bool isMemoryBound(const MachineModel & machine) const;
+  ///
+  /// \fn std::string getReport(const std::string & unit = "FLOP", bool binaryPrefixes = false) const
+  /// \brief Format mean and standard deviation of the throughput in a human readable string.
+  ///
+  /// @param unit The name of the counted operations
+  /// @param binaryPrefixes Use IEC prefixes, instead of SI, for the bandwidth
+  /// @return The formatted report
+  ///
+  std::string getReport(const std::string & unit = "FLOP", bool binaryPrefixes = false) const;
+  ///
+  /// \fn std::string getReport(const MachineModel & machine, const std::string & unit = "FLOP", bool binaryPrefixes = false) const
+  /// \brief Format the throughput, the arithmetic intensity, and the achieved percentage of the roofline.
+  ///
+  /// @param machine The model of the machine the intervals were measured on
+  /// @param unit The name of the counted operations
+  /// @param binaryPrefixes Use IEC prefixes, instead of SI, for the bandwidth
+  /// @return The formatted report
+  ///
+  std::string getReport(const MachineModel & machine, const std::string & unit = "FLOP", bool binaryPrefixes = false) const;
+
+private:
+  Timer timer;
+  Statistics<double> operationsPerSecond;
+  Statistics<double> bytesPerSecond;
+  std::uint64_t operations;
+  std::uint64_t bytes;
+  std::uint64_t totalOperations;
+  std::uint64_t totalBytes;
+};
+
+inline double MachineModel::getPeakOperations() const {
+  return peakOperations;
+}
+
+inline double MachineModel::getPeakBandwidth() const {
+  return peakBandwidth;
+}
+
+inline double MachineModel::getRidgePoint() const {
+  return peakOperations / peakBandwidth;
+}
+
+inline double MachineModel::getAttainableOperations(const double intensity) const {
+  return std::fmin(peakOperations, intensity * peakBandwidth);
+}
+
+inline void Throughput::start() {
+  timer.start();
+}
+
+inline void Throughput::stop() {
+  stop(operations, bytes);
+}
+
+inline void Throughput::stop(const std::uint64_t operations, const std::uint64_t bytes) {
+  timer.stop();
+  addRun(timer.getLastRunTime(), operations, bytes);
+}
+
+inline const Timer & Throughput::getTimer() const {
+  return timer;
+}
+
+inline std::uint64_t Throughput::getNrRuns() const {
+  return operationsPerSecond.getNrElements();
+}
+
+inline double Throughput::getOperationsPerSecond() const {
+  return operationsPerSecond.getMean();
+}
+
+inline double Throughput::getOperationsPerSecondStandardDeviation() const {
+  return operationsPerSecond.getStandardDeviation();
+}
+
+inline double Throughput::getBytesPerSecond() const {
+  return bytesPerSecond.getMean();
+}
+
+inline double Throughput::getBytesPerSecondStandardDeviation() const {
+  return bytesPerSecond.getStandardDeviation();
+}
+
+inline double Throughput::getArithmeticIntensity() const {
+  if ( totalBytes > 0 ) {
+    return totalOperations / static_cast<double>(totalBytes);
+  } else {
+    return 0.0;
+  }
+}
+
+inline bool Throughput::isAboveRoofline(const MachineModel & machine) const {
+  return getRooflinePercentage(machine) > 100.0;
+}
+
+inline bool Throughput::isMemoryBound(const MachineModel & machine) const {
+  return getArithmeticIntensity() < machine.getRidgePoint();
+}
+
+} // utils
+} // isa
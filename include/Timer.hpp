@@ -20,8 +20,9 @@
 // limitations under the License.
 
 #include <chrono>
+#include <limits>
 
-#include "Statistics.hpp"
+#include "Accumulator.hpp"
 
 #pragma once
 
@@ -104,14 +105,47 @@ public:
   /// @return The coefficient of variation between the timed intervals
   ///
   double getCoefficientOfVariation() const;
+  ///
+  /// \fn double getMinTime() const
+  /// \brief Retrieve the shortest timed interval, in seconds.
+  ///
+  /// @return The elapsed time of the shortest timed interval
+  ///
+  double getMinTime() const;
+  ///
+  /// \fn double getMaxTime() const
+  /// \brief Retrieve the longest timed interval, in seconds.
+  ///
+  /// @return The elapsed time of the longest timed interval
+  ///
+  double getMaxTime() const;
 
 private:
-  Statistics<double> stats;
+  Accumulator<double, Accumulate::Variance | Accumulate::MinMax> stats;
   std::chrono::high_resolution_clock::time_point starting;
   double totalTime;
   double time;
 };
 
+inline Timer::Timer() : starting(std::chrono::high_resolution_clock::time_point()), totalTime(0.0), time(0.0) {}
+
+inline void Timer::start() {
+  starting = std::chrono::high_resolution_clock::now();
+}
+
+inline void Timer::stop() {
+  time = (std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::high_resolution_clock::now() - starting)).count();
+  totalTime += time;
+  stats.addElement(time);
+}
+
+inline void Timer::reset() {
+  starting = std::chrono::high_resolution_clock::time_point();
+  totalTime = 0.0;
+  time = 0.0;
+  stats.reset();
+}
+
 inline std::uint64_t Timer::getNrRuns() const {
   return stats.getNrElements();
 }
@@ -136,6 +170,18 @@ inline double Timer::getCoefficientOfVariation() const {
   return stats.getCoefficientOfVariation();
 }
 
+inline double Timer::getMinTime() const {
+  return stats.getMin();
+}
+
+inline double Timer::getMaxTime() const {
+  // Without intervals, the same value returned when the statistics were kept in a Statistics object
+  if ( stats.getNrElements() == 0 ) {
+    return std::numeric_limits<double>::min();
+  }
+  return stats.getMax();
+}
+
 } // utils
 } // isa
 
@@ -0,0 +1,205 @@
+///
+/// \file Unpack.hpp
+/// \brief
+///
+/// Bulk packing and unpacking of 1, 2, 4 and 8 bits samples.
+///
+
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cinttypes>
+
+#pragma once
+
+namespace isa {
+namespace utils {
+
+// Packed samples are stored starting from the least significant bits of every byte, i.e. sample i is at bit (i * Bits) % 8
+// of byte (i * Bits) / 8, the same order used by getBit() and setBit(). Signed samples are in two's complement.
+// All functions are instantiated for Bits equal to 1, 2, 4 and 8.
+
+///
+/// \enum UnpackKernel
+/// \brief Implementations of the bulk packing and unpacking.
+///
+enum class UnpackKernel {
+  Scalar,
+  SSSE3
+};
+
+///
+/// \class UnpackTable
+/// \brief Lookup table mapping every packed byte to the values of its samples.
+///
+template<unsigned int Bits> class UnpackTable {
+  static_assert(Bits == 1 || Bits == 2 || Bits == 4 || Bits == 8, "UnpackTable supports 1, 2, 4 and 8 bits samples.");
+
+public:
+  ///
+  /// \fn explicit UnpackTable(const float * levels)
+  /// \brief Constructor, for an arbitrary mapping of the samples.
+  ///
+  /// @param levels The 2^Bits values of the samples, indexed by their packed bits
+  ///
+  explicit UnpackTable(const float * levels);
+  ///
+  /// \fn UnpackTable(bool isSigned, float scale, float offset)
+  /// \brief Constructor, for a linear mapping of the samples.
+  ///
+  /// @param isSigned True if the samples are signed
+  /// @param scale The value of one quantization step
+  /// @param offset The value added after scaling
+  ///
+  UnpackTable(bool isSigned, float scale, float offset);
+
+  ///
+  /// \fn inline const float * getSamples(std::uint8_t byte) const
+  /// \brief Retrieve the values of the samples contained in a byte.
+  ///
+  /// @param byte The packed byte
+  /// @return A pointer to the 8 / Bits values
+  ///
+  inline const float * getSamples(std::uint8_t byte) const;
+
+private:
+  void fill(const float * levels);
+
+  std::vector<float> table;
+};
+
+///
+/// \fn UnpackKernel getUnpackKernel()
+/// \brief Retrieve the kernel selected, at run time, for the running CPU.
+///
+/// @return The kernel used by pack() and unpack()
+///
+UnpackKernel getUnpackKernel();
+///
+/// \fn std::string toString(UnpackKernel kernel)
+/// \brief Retrieve the name of a kernel.
+///
+/// @param kernel The kernel
+/// @return The name of the kernel
+///
+std::string toString(UnpackKernel kernel);
+///
+/// \fn template<unsigned int Bits> void unpack(const std::uint8_t * input, std::int8_t * output, std::size_t nrSamples, bool isSigned = true)
+/// \brief Expand packed samples into bytes.
+///
+/// Unsigned 8 bits samples larger than 127 wrap around.
+///
+/// @param input The packed samples
+/// @param output The unpacked samples
+/// @param nrSamples The number of samples
+/// @param isSigned True if the samples are signed
+///
+template<unsigned int Bits> void unpack(const std::uint8_t * input, std::int8_t * output, std::size_t nrSamples, bool isSigned = true);
+///
+/// \fn template<unsigned int Bits> void unpack(const std::uint8_t * input, std::int16_t * output, std::size_t nrSamples, bool isSigned = true)
+/// \brief Expand packed samples into 16 bits integers.
+///
+/// @param input The packed samples
+/// @param output The unpacked samples
+/// @param nrSamples The number of samples
+/// @param isSigned True if the samples are signed
+///
+template<unsigned int Bits> void unpack(const std::uint8_t * input, std::int16_t * output, std::size_t nrSamples, bool isSigned = true);
+///
+/// \fn template<unsigned int Bits> void unpack(const std::uint8_t * input, float * output, std::size_t nrSamples, bool isSigned = true, float scale = 1.0f, float offset = 0.0f)
+/// \brief Expand packed samples into floating point values, computed as (sample * scale) + offset.
+///
+/// @param input The packed samples
+/// @param output The unpacked samples
+/// @param nrSamples The number of samples
+/// @param isSigned True if the samples are signed
+/// @param scale The value of one quantization step
+/// @param offset The value added after scaling
+///
+template<unsigned int Bits> void unpack(const std::uint8_t * input, float * output, std::size_t nrSamples, bool isSigned = true, float scale = 1.0f, float offset = 0.0f);
+///
+/// \fn template<unsigned int Bits> void unpack(const std::uint8_t * input, float * output, std::size_t nrSamples, const UnpackTable<Bits> & table)
+/// \brief Expand packed samples into floating point values using a lookup table.
+///
+/// @param input The packed samples
+/// @param output The unpacked samples
+/// @param nrSamples The number of samples
+/// @param table The lookup table
+///
+template<unsigned int Bits> void unpack(const std::uint8_t * input, float * output, std::size_t nrSamples, const UnpackTable<Bits> & table);
+///
+/// \fn template<unsigned int Bits> void pack(const std::int8_t * input, std::uint8_t * output, std::size_t nrSamples)
+/// \brief Pack samples, keeping the Bits least significant bits of every input value.
+///
+/// The unused bits of the last byte are set to zero.
+///
+/// @param input The unpacked samples
+/// @param output The packed samples
+/// @param nrSamples The number of samples
+///
+template<unsigned int Bits> void pack(const std::int8_t * input, std::uint8_t * output, std::size_t nrSamples);
+///
+/// \fn template<unsigned int Bits> void pack(const float * input, std::uint8_t * output, std::size_t nrSamples, bool isSigned = true, float scale = 1.0f, float offset = 0.0f)
+/// \brief Quantize and pack floating point values, the inverse of unpack(); values outside the representable range are clamped.
+///
+/// NaN values are packed as zero, i.e. the level unpacked as offset.
+///
+/// @param input The unpacked samples
+/// @param output The packed samples
+/// @param nrSamples The number of samples
+/// @param isSigned True if the samples are signed
+/// @param scale The value of one quantization step
+/// @param offset The value subtracted before scaling
+///
+template<unsigned int Bits> void pack(const float * input, std::uint8_t * output, std::size_t nrSamples, bool isSigned = true, float scale = 1.0f, float offset = 0.0f);
+
+
+template<unsigned int Bits> UnpackTable<Bits>::UnpackTable(const float * levels) {
+  fill(levels);
+}
+
+template<unsigned int Bits> UnpackTable<Bits>::UnpackTable(const bool isSigned, const float scale, const float offset) {
+  float levels[1 << Bits];
+
+  for ( unsigned int field = 0; field < (1u << Bits); field++ ) {
+    int value = static_cast<int>(field);
+
+    if ( isSigned && field >= (1u << (Bits - 1)) ) {
+      value -= (1 << Bits);
+    }
+    levels[field] = (value * scale) + offset;
+  }
+  fill(levels);
+}
+
+template<unsigned int Bits> void UnpackTable<Bits>::fill(const float * levels) {
+  const unsigned int nrSamples = 8 / Bits;
+
+  table.resize(256 * nrSamples);
+  for ( unsigned int byte = 0; byte < 256; byte++ ) {
+    for ( unsigned int sample = 0; sample < nrSamples; sample++ ) {
+      table.at((byte * nrSamples) + sample) = levels[(byte >> (sample * Bits)) & ((1u << Bits) - 1)];
+    }
+  }
+}
+
+template<unsigned int Bits> inline const float * UnpackTable<Bits>::getSamples(const std::uint8_t byte) const {
+  return table.data() + (byte * (8 / Bits));
+}
+
+} // utils
+} // isa
@@ -21,6 +21,7 @@
 
 #include <string>
 #include <sstream>
+#include <iomanip>
 #include <cstdlib>
 #include <cmath>
 #include <cinttypes>
@@ -42,6 +43,19 @@ namespace utils {
 ///
 std::string * replace(std::string * src, const std::string & placeholder, const std::string & item, bool deleteSrc = false);
 ///
+/// \fn template<typename String> void replace(const std::string & src, const std::string & placeholder, const std::string & item, String & output)
+/// \brief Replace all of the placeholder occurrences in the source string with some value, writing the result in an existing string.
+/// The capacity of the output string is reused, so that repeated calls do not allocate memory once it is large enough;
+/// the output string can also use a different allocator, e.g. an ArenaAllocator. The output can be the same string as
+/// one of the inputs, in which case the result is built in a temporary string first.
+///
+/// @param src The string to modify
+/// @param placeholder The placeholder to replace in the input string
+/// @param item The content to replace the placeholder with
+/// @param output The string containing the result
+///
+template<typename String> void replace(const std::string & src, const std::string & placeholder, const std::string & item, String & output);
+///
 /// \fn template<typename OldType, typename NewType> NewType castToType(OldType item)
 /// \brief Casts the value of a variable from OldType to NewType.
 /// This function is intended mainly to convert the value of a string to a numeric type, and it should not be used if more precise casting is possible,
@@ -78,6 +92,16 @@ void bigEndianToLittleEndian(std::uint32_t * value);
 ///
 std::uint64_t pad(std::uint64_t x, unsigned int padding);
 ///
+/// \fn template<std::uint64_t Padding> constexpr std::uint64_t pad(std::uint64_t x)
+/// \brief Pad the value of a variable to the closest, larger or equal, multiple of a padding factor known at compile time.
+///
+/// Only integer arithmetic is used; power of two factors are reduced to a mask.
+///
+/// @param x Variable to pad
+/// @return Padded value
+///
+template<std::uint64_t Padding> constexpr std::uint64_t pad(std::uint64_t x);
+///
 /// \fn template<typename Type> std::uint8_t getBit(Type bitmap, std::uint8_t bit)
 /// \brief Read a specific bit in a variable.
 ///
@@ -159,6 +183,30 @@ template<typename NumericType> double mebi(NumericType x);
 /// @return The value of the input divided by 2^10
 ///
 template<typename NumericType> double kibi(NumericType x);
+///
+/// \fn std::string formatSI(double value, const std::string & unit, unsigned int precision = 2)
+/// \brief Format a value using the largest decimal (SI) prefix that keeps it above one.
+///
+/// The prefixes are the same of tera(), giga(), mega() and kilo().
+///
+/// @param value The value to format
+/// @param unit The unit of measure appended after the prefix
+/// @param precision The number of decimal digits
+/// @return A string like "12.34 GFLOP/s"
+///
+std::string formatSI(double value, const std::string & unit, unsigned int precision = 2);
+///
+/// \fn std::string formatIEC(double value, const std::string & unit, unsigned int precision = 2)
+/// \brief Format a value using the largest binary (IEC) prefix that keeps it above one.
+///
+/// The prefixes are the same of tebi(), gibi(), mebi() and kibi().
+///
+/// @param value The value to format
+/// @param unit The unit of measure appended after the prefix
+/// @param precision The number of decimal digits
+/// @return A string like "1.50 GiB/s"
+///
+std::string formatIEC(double value, const std::string & unit, unsigned int precision = 2);
 
 
 template<typename OldType, typename NewType> NewType castToType(const OldType item) {
@@ -185,12 +233,42 @@ inline void bigEndianToLittleEndian(std::uint32_t * value) {
   *value = bitmap;
 }
 
+template<typename String> void replace(const std::string & src, const std::string & placeholder, const std::string & item, String & output) {
+  std::size_t position = 0;
+  std::size_t oldPosition = 0;
+  const void * destination = static_cast<const void *>(&output);
+
+  // Clearing the output would also clear the input
+  if ( destination == static_cast<const void *>(&src) || destination == static_cast<const void *>(&placeholder) || destination == static_cast<const void *>(&item) ) {
+    String temporary(output.get_allocator());
+
+    replace(src, placeholder, item, temporary);
+    output.swap(temporary);
+    return;
+  }
+  output.clear();
+  while ( (position = src.find(placeholder, position)) < std::string::npos ) {
+    output.append(src.data() + oldPosition, position - oldPosition);
+    output.append(item.data(), item.size());
+    position += placeholder.length();
+    oldPosition = position;
+  }
+  output.append(src.data() + oldPosition, src.size() - oldPosition);
+}
+
 inline std::uint64_t pad(const std::uint64_t x, const unsigned int padding) {
-  if ( (x % padding) == 0 ) {
-    return x;
-  } else {
-    return static_cast<std::uint64_t>(padding * std::ceil(x / static_cast<double>(padding)));
+  if ( (padding & (padding - 1)) == 0 ) {
+    return (x + (padding - 1)) & ~static_cast<std::uint64_t>(padding - 1);
+  }
+  return ((x + (padding - 1)) / padding) * padding;
+}
+
+template<std::uint64_t Padding> constexpr std::uint64_t pad(const std::uint64_t x) {
+  static_assert(Padding > 0, "The padding factor must be larger than zero.");
+  if ( (Padding & (Padding - 1)) == 0 ) {
+    return (x + (Padding - 1)) & ~(Padding - 1);
   }
+  return ((x + (Padding - 1)) / Padding) * Padding;
 }
 
 template<typename Type> inline std::uint8_t getBit(const Type bitmap, const std::uint8_t bit) {
@@ -241,6 +319,60 @@ template<typename NumericType> inline double kibi(const NumericType x) {
   return x / 1024.0;
 }
 
+inline std::string * replace(std::string * src, const std::string & placeholder, const std::string & item, const bool deleteSrc) {
+  auto * newString = new std::string();
+
+  replace(*src, placeholder, item, *newString);
+
+  if ( deleteSrc ) {
+    delete src;
+  }
+
+  return newString;
+}
+
+inline std::string formatSI(const double value, const std::string & unit, const unsigned int precision) {
+  std::stringstream output;
+  double magnitude = std::abs(value);
+
+  output << std::fixed << std::setprecision(precision);
+  if ( magnitude >= 1.0e+12 ) {
+    output << tera(value) << " T";
+  } else if ( magnitude >= 1.0e+09 ) {
+    output << giga(value) << " G";
+  } else if ( magnitude >= 1.0e+06 ) {
+    output << mega(value) << " M";
+  } else if ( magnitude >= 1.0e+03 ) {
+    output << kilo(value) << " k";
+  } else {
+    output << value << " ";
+  }
+  output << unit;
+
+  return output.str();
+}
+
+inline std::string formatIEC(const double value, const std::string & unit, const unsigned int precision) {
+  std::stringstream output;
+  double magnitude = std::abs(value);
+
+  output << std::fixed << std::setprecision(precision);
+  if ( magnitude >= 1099511627776.0 ) {
+    output << tebi(value) << " Ti";
+  } else if ( magnitude >= 1073741824.0 ) {
+    output << gibi(value) << " Gi";
+  } else if ( magnitude >= 1048576.0 ) {
+    output << mebi(value) << " Mi";
+  } else if ( magnitude >= 1024.0 ) {
+    output << kibi(value) << " Ki";
+  } else {
+    output << value << " ";
+  }
+  output << unit;
+
+  return output.str();
+}
+
 } // utils
 } // isa
 
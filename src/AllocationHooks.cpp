@@ -0,0 +1,108 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replacement global operator new and delete, built as the separate isa_utils_allocation_hooks library.
+// Every block is prefixed with a header containing its size, so that freed bytes can be accounted for without relying on sized deallocation.
+
+#include <Allocations.hpp>
+#include <new>
+#include <cstdlib>
+
+namespace isa {
+namespace utils {
+
+void markAllocationHooksInstalled();
+
+namespace {
+
+// Keeps the returned pointers aligned as malloc() does
+constexpr std::size_t headerSize = 16;
+
+const bool installed = (markAllocationHooksInstalled(), true);
+
+void * allocate(const std::size_t bytes) noexcept {
+  void * block = nullptr;
+
+  while ( (block = std::malloc(bytes + headerSize)) == nullptr ) {
+    std::new_handler handler = std::get_new_handler();
+
+    if ( handler == nullptr ) {
+      return nullptr;
+    }
+    handler();
+  }
+  *static_cast<std::size_t *>(block) = bytes;
+  recordAllocation(bytes);
+
+  return static_cast<char *>(block) + headerSize;
+}
+
+void deallocate(void * pointer) noexcept {
+  if ( pointer == nullptr ) {
+    return;
+  }
+  void * block = static_cast<char *>(pointer) - headerSize;
+
+  recordDeallocation(*static_cast<std::size_t *>(block));
+  std::free(block);
+}
+
+} // (anonymous)
+} // utils
+} // isa
+
+void * operator new(std::size_t bytes) {
+  void * pointer = isa::utils::allocate(bytes);
+
+  if ( pointer == nullptr ) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void * operator new[](std::size_t bytes) {
+  return ::operator new(bytes);
+}
+
+void * operator new(std::size_t bytes, const std::nothrow_t &) noexcept {
+  return isa::utils::allocate(bytes);
+}
+
+void * operator new[](std::size_t bytes, const std::nothrow_t &) noexcept {
+  return isa::utils::allocate(bytes);
+}
+
+void operator delete(void * pointer) noexcept {
+  isa::utils::deallocate(pointer);
+}
+
+void operator delete[](void * pointer) noexcept {
+  isa::utils::deallocate(pointer);
+}
+
+void operator delete(void * pointer, std::size_t) noexcept {
+  isa::utils::deallocate(pointer);
+}
+
+void operator delete[](void * pointer, std::size_t) noexcept {
+  isa::utils::deallocate(pointer);
+}
+
+void operator delete(void * pointer, const std::nothrow_t &) noexcept {
+  isa::utils::deallocate(pointer);
+}
+
+void operator delete[](void * pointer, const std::nothrow_t &) noexcept {
+  isa::utils::deallocate(pointer);
+}
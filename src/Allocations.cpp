@@ -0,0 +1,179 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Allocations.hpp>
+#include <utils.hpp>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+#include <sys/resource.h>
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+// Plain aggregate, so that the thread local storage needs no dynamic initialization and is safe to use from operator new
+struct ThreadCounters {
+  std::uint64_t nrAllocations;
+  std::uint64_t nrDeallocations;
+  std::uint64_t allocatedBytes;
+  std::uint64_t freedBytes;
+  std::int64_t liveBytes;
+  std::int64_t peakLiveBytes;
+};
+
+thread_local ThreadCounters counters = {0, 0, 0, 0, 0, 0};
+std::atomic<bool> hooksInstalled(false);
+
+AllocationCounters difference(const AllocationCounters & end, const AllocationCounters & begin) {
+  AllocationCounters delta;
+
+  delta.nrAllocations = end.nrAllocations - begin.nrAllocations;
+  delta.nrDeallocations = end.nrDeallocations - begin.nrDeallocations;
+  delta.allocatedBytes = end.allocatedBytes - begin.allocatedBytes;
+  delta.freedBytes = end.freedBytes - begin.freedBytes;
+  delta.liveBytes = end.liveBytes - begin.liveBytes;
+  delta.peakLiveBytes = end.peakLiveBytes - begin.liveBytes;
+  if ( delta.peakLiveBytes < 0 ) {
+    delta.peakLiveBytes = 0;
+  }
+
+  return delta;
+}
+
+} // (anonymous)
+
+// Called by the static initializer of the allocation hooks
+void markAllocationHooksInstalled() {
+  hooksInstalled = true;
+}
+
+bool allocationHooksInstalled() {
+  return hooksInstalled.load();
+}
+
+void recordAllocation(const std::size_t bytes) {
+  counters.nrAllocations++;
+  counters.allocatedBytes += bytes;
+  counters.liveBytes += bytes;
+  if ( counters.liveBytes > counters.peakLiveBytes ) {
+    counters.peakLiveBytes = counters.liveBytes;
+  }
+}
+
+void recordDeallocation(const std::size_t bytes) {
+  counters.nrDeallocations++;
+  counters.freedBytes += bytes;
+  counters.liveBytes -= bytes;
+}
+
+AllocationCounters getAllocationCounters() {
+  AllocationCounters current;
+
+  current.nrAllocations = counters.nrAllocations;
+  current.nrDeallocations = counters.nrDeallocations;
+  current.allocatedBytes = counters.allocatedBytes;
+  current.freedBytes = counters.freedBytes;
+  current.liveBytes = counters.liveBytes;
+  current.peakLiveBytes = counters.peakLiveBytes;
+
+  return current;
+}
+
+MemoryUsage getMemoryUsage() {
+  MemoryUsage usage;
+  struct rusage resources;
+  std::ifstream statm("/proc/self/statm");
+  std::uint64_t pages = 0;
+
+  // The second field of statm is the number of resident pages
+  if ( statm >> pages >> pages ) {
+    usage.residentBytes = pages * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+  }
+  if ( getrusage(RUSAGE_SELF, &resources) == 0 ) {
+    usage.peakResidentBytes = static_cast<std::uint64_t>(resources.ru_maxrss) * 1024;
+    usage.minorPageFaults = resources.ru_minflt;
+    usage.majorPageFaults = resources.ru_majflt;
+  }
+  // ru_maxrss is only updated periodically by the kernel, and may lag behind the current sample
+  if ( usage.residentBytes > usage.peakResidentBytes ) {
+    usage.peakResidentBytes = usage.residentBytes;
+  }
+
+  return usage;
+}
+
+AllocationScope::AllocationScope() : begin(getAllocationCounters()), outerPeak(counters.peakLiveBytes) {
+  counters.peakLiveBytes = counters.liveBytes;
+}
+
+AllocationScope::~AllocationScope() {
+  if ( outerPeak > counters.peakLiveBytes ) {
+    counters.peakLiveBytes = outerPeak;
+  }
+}
+
+AllocationCounters AllocationScope::getCounters() const {
+  return difference(getAllocationCounters(), begin);
+}
+
+AllocationProfiler::AllocationProfiler() : outerPeak(0), totalAllocations(0), totalAllocatedBytes(0), peakLiveBytes(0) {}
+
+void AllocationProfiler::start() {
+  begin = getAllocationCounters();
+  outerPeak = counters.peakLiveBytes;
+  counters.peakLiveBytes = counters.liveBytes;
+  timer.start();
+}
+
+void AllocationProfiler::stop() {
+  timer.stop();
+  lastRun = difference(getAllocationCounters(), begin);
+  if ( outerPeak > counters.peakLiveBytes ) {
+    counters.peakLiveBytes = outerPeak;
+  }
+  totalAllocations += lastRun.nrAllocations;
+  totalAllocatedBytes += lastRun.allocatedBytes;
+  if ( lastRun.peakLiveBytes > peakLiveBytes ) {
+    peakLiveBytes = lastRun.peakLiveBytes;
+  }
+  allocationsPerRun.addElement(static_cast<double>(lastRun.nrAllocations));
+}
+
+void AllocationProfiler::reset() {
+  timer.reset();
+  lastRun = AllocationCounters();
+  totalAllocations = 0;
+  totalAllocatedBytes = 0;
+  peakLiveBytes = 0;
+  allocationsPerRun.reset();
+}
+
+std::string AllocationProfiler::getReport() const {
+  std::stringstream report;
+
+  report << timer.getAverageTime() << " s +/- " << timer.getStandardDeviation() << " s, ";
+  report << allocationsPerRun.getMean() << " allocations/run, ";
+  if ( timer.getNrRuns() > 0 ) {
+    report << formatIEC(totalAllocatedBytes / static_cast<double>(timer.getNrRuns()), "B/run") << ", ";
+  }
+  report << formatIEC(static_cast<double>(peakLiveBytes), "B") << " peak";
+
+  return report.str();
+}
+
+} // utils
+} // isa
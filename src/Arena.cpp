@@ -0,0 +1,137 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Arena.hpp>
+#include <utils.hpp>
+#include <cstdlib>
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+// Chunks are obtained from operator new, so that they are visible to the allocation instrumentation
+void * allocateChunk(const std::size_t bytes, const std::size_t alignment) {
+  if ( alignment <= alignof(std::max_align_t) ) {
+    return ::operator new(bytes);
+  }
+  void * pointer = nullptr;
+
+  if ( posix_memalign(&pointer, alignment, bytes) != 0 ) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void freeChunk(void * pointer, const std::size_t alignment) {
+  if ( alignment <= alignof(std::max_align_t) ) {
+    ::operator delete(pointer);
+  } else {
+    std::free(pointer);
+  }
+}
+
+} // (anonymous)
+
+Arena::Arena(const std::size_t chunkSize, const std::size_t alignment) : chunkSize(chunkSize), alignment(alignment), current(0), offset(0), usedBytes(0), highWaterMark(0), capacity(0), nrChunkAllocations(0) {}
+
+Arena::~Arena() {
+  release();
+}
+
+void * Arena::allocate(const std::size_t bytes, std::size_t alignment) {
+  if ( alignment == 0 ) {
+    alignment = this->alignment;
+  }
+  while ( true ) {
+    if ( current >= chunks.size() ) {
+      newChunk(bytes, alignment);
+    }
+    Chunk & chunk = chunks.at(current);
+    const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(chunk.memory);
+    const std::size_t aligned = pad(base + offset, static_cast<unsigned int>(alignment)) - base;
+
+    // Written so that large requests cannot overflow
+    if ( aligned <= chunk.size && bytes <= chunk.size - aligned ) {
+      usedBytes += (aligned - offset) + bytes;
+      offset = aligned + bytes;
+      if ( usedBytes > highWaterMark ) {
+        highWaterMark = usedBytes;
+      }
+      return chunk.memory + aligned;
+    }
+    // The unused tail of the chunk is accounted as used until the next reset
+    usedBytes += chunk.size - offset;
+    current++;
+    offset = 0;
+  }
+}
+
+void Arena::newChunk(const std::size_t bytes, const std::size_t alignment) {
+  Chunk chunk;
+
+  chunk.size = (bytes > chunkSize) ? bytes : chunkSize;
+  // Chunks are aligned to the largest of the default and the requested alignment
+  chunk.alignment = (alignment > this->alignment) ? alignment : this->alignment;
+  chunk.memory = static_cast<unsigned char *>(allocateChunk(chunk.size, chunk.alignment));
+  chunks.push_back(chunk);
+  capacity += chunk.size;
+  nrChunkAllocations++;
+}
+
+void Arena::reset() {
+  current = 0;
+  offset = 0;
+  usedBytes = 0;
+}
+
+void Arena::release() {
+  for ( auto & chunk : chunks ) {
+    freeChunk(chunk.memory, chunk.alignment);
+  }
+  chunks.clear();
+  capacity = 0;
+  reset();
+}
+
+Arena & Arena::getThreadLocal() {
+  thread_local Arena arena;
+
+  return arena;
+}
+
+FixedSizePool::FixedSizePool(const std::size_t blockSize, const std::size_t alignment, const std::size_t blocksPerChunk) : freeList(nullptr), blockSize(pad(blockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : blockSize, static_cast<unsigned int>(alignment))), alignment(alignment), blocksPerChunk(blocksPerChunk > 0 ? blocksPerChunk : 1), nrLiveBlocks(0), highWaterMark(0), nrChunkAllocations(0) {}
+
+FixedSizePool::~FixedSizePool() {
+  for ( auto chunk : chunks ) {
+    freeChunk(chunk, alignment);
+  }
+}
+
+void FixedSizePool::grow() {
+  unsigned char * chunk = static_cast<unsigned char *>(allocateChunk(blockSize * blocksPerChunk, alignment));
+
+  chunks.push_back(chunk);
+  nrChunkAllocations++;
+  // Thread the new blocks in the free list, in address order
+  for ( std::size_t block = blocksPerChunk; block > 0; block-- ) {
+    FreeBlock * freeBlock = reinterpret_cast<FreeBlock *>(chunk + ((block - 1) * blockSize));
+
+    freeBlock->next = freeList;
+    freeList = freeBlock;
+  }
+}
+
+} // utils
+} // isa
@@ -0,0 +1,498 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Bitmap.hpp>
+#include <utils.hpp>
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ISA_UTILS_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+// The storage is padded to 64 bytes, so that the vector kernels never need a scalar tail
+constexpr std::size_t wordsPerBlock = 8;
+constexpr std::uint64_t allOnes = ~static_cast<std::uint64_t>(0);
+
+struct And {
+  static inline std::uint64_t apply(const std::uint64_t left, const std::uint64_t right) {
+    return left & right;
+  }
+#ifdef ISA_UTILS_X86_DISPATCH
+  __attribute__((target("avx2"))) static inline __m256i apply(const __m256i left, const __m256i right) {
+    return _mm256_and_si256(left, right);
+  }
+  __attribute__((target("avx512f"))) static inline __m512i apply(const __m512i left, const __m512i right) {
+    return _mm512_and_si512(left, right);
+  }
+#endif
+};
+
+struct Or {
+  static inline std::uint64_t apply(const std::uint64_t left, const std::uint64_t right) {
+    return left | right;
+  }
+#ifdef ISA_UTILS_X86_DISPATCH
+  __attribute__((target("avx2"))) static inline __m256i apply(const __m256i left, const __m256i right) {
+    return _mm256_or_si256(left, right);
+  }
+  __attribute__((target("avx512f"))) static inline __m512i apply(const __m512i left, const __m512i right) {
+    return _mm512_or_si512(left, right);
+  }
+#endif
+};
+
+struct Xor {
+  static inline std::uint64_t apply(const std::uint64_t left, const std::uint64_t right) {
+    return left ^ right;
+  }
+#ifdef ISA_UTILS_X86_DISPATCH
+  __attribute__((target("avx2"))) static inline __m256i apply(const __m256i left, const __m256i right) {
+    return _mm256_xor_si256(left, right);
+  }
+  __attribute__((target("avx512f"))) static inline __m512i apply(const __m512i left, const __m512i right) {
+    return _mm512_xor_si512(left, right);
+  }
+#endif
+};
+
+struct AndNot {
+  static inline std::uint64_t apply(const std::uint64_t left, const std::uint64_t right) {
+    return left & ~right;
+  }
+#ifdef ISA_UTILS_X86_DISPATCH
+  __attribute__((target("avx2"))) static inline __m256i apply(const __m256i left, const __m256i right) {
+    return _mm256_andnot_si256(right, left);
+  }
+  __attribute__((target("avx512f"))) static inline __m512i apply(const __m512i left, const __m512i right) {
+    // The zero masking version, because _mm512_andnot_si512() triggers a -Wmaybe-uninitialized false positive in GCC 12
+    return _mm512_maskz_andnot_epi64(static_cast<__mmask8>(0xff), right, left);
+  }
+#endif
+};
+
+#ifdef ISA_UTILS_X86_DISPATCH
+template<typename Operation> __attribute__((target("avx2"))) void combineAVX2(std::uint64_t * left, const std::uint64_t * right, const std::size_t nrWords) {
+  for ( std::size_t word = 0; word < nrWords; word += 4 ) {
+    __m256i result = Operation::apply(_mm256_load_si256(reinterpret_cast<const __m256i *>(left + word)), _mm256_load_si256(reinterpret_cast<const __m256i *>(right + word)));
+
+    _mm256_store_si256(reinterpret_cast<__m256i *>(left + word), result);
+  }
+}
+
+template<typename Operation> __attribute__((target("avx512f"))) void combineAVX512(std::uint64_t * left, const std::uint64_t * right, const std::size_t nrWords) {
+  for ( std::size_t word = 0; word < nrWords; word += 8 ) {
+    _mm512_store_si512(left + word, Operation::apply(_mm512_load_si512(left + word), _mm512_load_si512(right + word)));
+  }
+}
+
+__attribute__((target("avx2"))) std::size_t countAVX2(const std::uint64_t * words, const std::size_t nrWords) {
+  // Count the bits of every nibble with a shuffle, then sum the bytes
+  const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  __m256i total = _mm256_setzero_si256();
+
+  for ( std::size_t word = 0; word < nrWords; word += 4 ) {
+    __m256i value = _mm256_load_si256(reinterpret_cast<const __m256i *>(words + word));
+    __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(value, mask));
+    __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(value, 4), mask));
+
+    total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+  }
+
+  return _mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) + _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3);
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq"))) std::size_t countAVX512(const std::uint64_t * words, const std::size_t nrWords) {
+  __m512i total = _mm512_setzero_si512();
+
+  for ( std::size_t word = 0; word < nrWords; word += 8 ) {
+    total = _mm512_add_epi64(total, _mm512_popcnt_epi64(_mm512_load_si512(words + word)));
+  }
+
+  // Not _mm512_reduce_add_epi64(), that triggers a -Wmaybe-uninitialized false positive in GCC 12
+  alignas(64) std::uint64_t lanes[8];
+
+  _mm512_store_si512(lanes, total);
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+}
+
+// The kernels read the words as bytes, in little endian order, and return the number of samples processed; blocks without flags are not written
+__attribute__((target("avx2"))) std::size_t applyMaskAVX2(const unsigned char * flags, float * data, const std::size_t nrSamples, const float value) {
+  const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+  const __m256 replacement = _mm256_set1_ps(value);
+  std::size_t sample = 0;
+
+  for ( ; sample + 8 <= nrSamples; sample += 8 ) {
+    if ( flags[sample / 8] == 0 ) {
+      continue;
+    }
+    __m256i lanes = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(flags[sample / 8]), bits), bits);
+    _mm256_storeu_ps(data + sample, _mm256_blendv_ps(_mm256_loadu_ps(data + sample), replacement, _mm256_castsi256_ps(lanes)));
+  }
+
+  return sample;
+}
+
+__attribute__((target("avx512f"))) std::size_t applyMaskAVX512(const unsigned char * flags, float * data, const std::size_t nrSamples, const float value) {
+  const __m512 replacement = _mm512_set1_ps(value);
+  std::size_t sample = 0;
+
+  for ( ; sample + 16 <= nrSamples; sample += 16 ) {
+    std::uint16_t block;
+
+    std::memcpy(&block, flags + (sample / 8), sizeof(block));
+    if ( block == 0 ) {
+      continue;
+    }
+    _mm512_storeu_ps(data + sample, _mm512_mask_mov_ps(_mm512_loadu_ps(data + sample), static_cast<__mmask16>(block), replacement));
+  }
+
+  return sample;
+}
+
+// Permutations moving the lanes to keep to the front of the register, for every combination of 8 flags
+struct CompactTable {
+  alignas(32) std::int32_t indices[256][8];
+
+  CompactTable() {
+    for ( unsigned int keep = 0; keep < 256; keep++ ) {
+      unsigned int position = 0;
+
+      for ( unsigned int lane = 0; lane < 8; lane++ ) {
+        if ( (keep >> lane) & 1 ) {
+          indices[keep][position++] = static_cast<std::int32_t>(lane);
+        }
+      }
+      while ( position < 8 ) {
+        indices[keep][position++] = 0;
+      }
+    }
+  }
+};
+
+// Every store writes a full register at the output position, that is never ahead of the input position
+__attribute__((target("avx2"))) std::size_t compactAVX2(const unsigned char * flags, const float * input, float * output, const std::size_t nrSamples, std::size_t & nrKept) {
+  static const CompactTable table;
+  std::size_t sample = 0;
+
+  for ( ; sample + 8 <= nrSamples; sample += 8 ) {
+    const unsigned int keep = (~flags[sample / 8]) & 0xff;
+    __m256i permutation = _mm256_load_si256(reinterpret_cast<const __m256i *>(table.indices[keep]));
+
+    _mm256_storeu_ps(output + nrKept, _mm256_permutevar8x32_ps(_mm256_loadu_ps(input + sample), permutation));
+    nrKept += __builtin_popcount(keep);
+  }
+
+  return sample;
+}
+
+__attribute__((target("avx512f"))) std::size_t compactAVX512(const unsigned char * flags, const float * input, float * output, const std::size_t nrSamples, std::size_t & nrKept) {
+  std::size_t sample = 0;
+
+  for ( ; sample + 16 <= nrSamples; sample += 16 ) {
+    std::uint16_t block;
+
+    std::memcpy(&block, flags + (sample / 8), sizeof(block));
+    const __mmask16 keep = static_cast<__mmask16>(~block);
+    _mm512_mask_compressstoreu_ps(output + nrKept, keep, _mm512_loadu_ps(input + sample));
+    nrKept += __builtin_popcount(static_cast<std::uint16_t>(~block));
+  }
+
+  return sample;
+}
+#endif // ISA_UTILS_X86_DISPATCH
+
+BitmapKernel selectKernel() {
+  for ( auto kernel : {BitmapKernel::AVX512, BitmapKernel::AVX2} ) {
+    if ( isSupported(kernel) ) {
+      return kernel;
+    }
+  }
+  return BitmapKernel::Scalar;
+}
+
+std::atomic<BitmapKernel> & selectedKernel() {
+  static std::atomic<BitmapKernel> kernel(selectKernel());
+
+  return kernel;
+}
+
+template<typename Operation> void combine(std::uint64_t * left, const std::uint64_t * right, const std::size_t nrWords) {
+#ifdef ISA_UTILS_X86_DISPATCH
+  switch ( getBitmapKernel() ) {
+    case BitmapKernel::AVX512:
+      combineAVX512<Operation>(left, right, nrWords);
+      return;
+    case BitmapKernel::AVX2:
+      combineAVX2<Operation>(left, right, nrWords);
+      return;
+    default:
+      break;
+  }
+#endif
+  for ( std::size_t word = 0; word < nrWords; word++ ) {
+    left[word] = Operation::apply(left[word], right[word]);
+  }
+}
+
+} // (anonymous)
+
+BitmapError::BitmapError(const std::string & message) : errorMessage(message) {}
+
+const char * BitmapError::what() const noexcept {
+  return this->errorMessage.c_str();
+}
+
+constexpr std::size_t Bitmap::npos;
+
+Bitmap::Bitmap(const std::size_t nrBits, const bool value) : nrBits(nrBits), words(pad<wordsPerBlock>((nrBits + 63) / 64), 0) {
+  if ( value ) {
+    setRange(0, nrBits);
+  }
+}
+
+void Bitmap::setRange(const std::size_t first, std::size_t last) {
+  if ( last > nrBits ) {
+    last = nrBits;
+  }
+  if ( first >= last ) {
+    return;
+  }
+  const std::size_t firstWord = first / 64;
+  const std::size_t lastWord = (last - 1) / 64;
+  const std::uint64_t firstMask = allOnes << (first % 64);
+  const std::uint64_t lastMask = allOnes >> (63 - ((last - 1) % 64));
+
+  if ( firstWord == lastWord ) {
+    words[firstWord] |= firstMask & lastMask;
+    return;
+  }
+  words[firstWord] |= firstMask;
+  for ( std::size_t word = firstWord + 1; word < lastWord; word++ ) {
+    words[word] = allOnes;
+  }
+  words[lastWord] |= lastMask;
+}
+
+void Bitmap::clearRange(const std::size_t first, std::size_t last) {
+  if ( last > nrBits ) {
+    last = nrBits;
+  }
+  if ( first >= last ) {
+    return;
+  }
+  const std::size_t firstWord = first / 64;
+  const std::size_t lastWord = (last - 1) / 64;
+  const std::uint64_t firstMask = allOnes << (first % 64);
+  const std::uint64_t lastMask = allOnes >> (63 - ((last - 1) % 64));
+
+  if ( firstWord == lastWord ) {
+    words[firstWord] &= ~(firstMask & lastMask);
+    return;
+  }
+  words[firstWord] &= ~firstMask;
+  for ( std::size_t word = firstWord + 1; word < lastWord; word++ ) {
+    words[word] = 0;
+  }
+  words[lastWord] &= ~lastMask;
+}
+
+Bitmap & Bitmap::operator&=(const Bitmap & other) {
+  checkSize(other);
+  combine<And>(words.data(), other.words.data(), words.size());
+
+  return *this;
+}
+
+Bitmap & Bitmap::operator|=(const Bitmap & other) {
+  checkSize(other);
+  combine<Or>(words.data(), other.words.data(), words.size());
+
+  return *this;
+}
+
+Bitmap & Bitmap::operator^=(const Bitmap & other) {
+  checkSize(other);
+  combine<Xor>(words.data(), other.words.data(), words.size());
+
+  return *this;
+}
+
+Bitmap & Bitmap::andNot(const Bitmap & other) {
+  checkSize(other);
+  combine<AndNot>(words.data(), other.words.data(), words.size());
+
+  return *this;
+}
+
+std::size_t Bitmap::count() const {
+#ifdef ISA_UTILS_X86_DISPATCH
+  switch ( getBitmapKernel() ) {
+    case BitmapKernel::AVX512:
+      return countAVX512(words.data(), words.size());
+    case BitmapKernel::AVX2:
+      return countAVX2(words.data(), words.size());
+    default:
+      break;
+  }
+#endif
+  std::size_t total = 0;
+
+  for ( auto word : words ) {
+    total += __builtin_popcountll(word);
+  }
+
+  return total;
+}
+
+std::size_t Bitmap::findFirst() const {
+  return findFrom(0);
+}
+
+std::size_t Bitmap::findNext(const std::size_t bit) const {
+  if ( bit >= nrBits ) {
+    return npos;
+  }
+
+  return findFrom(bit + 1);
+}
+
+std::size_t Bitmap::findFrom(const std::size_t bit) const {
+  if ( bit >= nrBits ) {
+    return npos;
+  }
+  std::size_t word = bit / 64;
+  std::uint64_t value = words[word] & (allOnes << (bit % 64));
+
+  // The bits after the last one are zero, so the first set bit found is always valid
+  while ( value == 0 ) {
+    word++;
+    if ( word >= words.size() ) {
+      return npos;
+    }
+    value = words[word];
+  }
+
+  return (word * 64) + __builtin_ctzll(value);
+}
+
+void Bitmap::checkSize(const Bitmap & other) const {
+  if ( other.nrBits != nrBits ) {
+    throw BitmapError("ERROR: bitmaps of different sizes (" + std::to_string(nrBits) + " and " + std::to_string(other.nrBits) + " bits)");
+  }
+}
+
+void Bitmap::throwOutOfRange(const std::size_t bit) const {
+  throw BitmapError("ERROR: bit " + std::to_string(bit) + " outside of a bitmap of " + std::to_string(nrBits) + " bits");
+}
+
+BitmapKernel getBitmapKernel() {
+  return selectedKernel().load(std::memory_order_relaxed);
+}
+
+bool setBitmapKernel(const BitmapKernel kernel) {
+  if ( !isSupported(kernel) ) {
+    return false;
+  }
+  selectedKernel().store(kernel, std::memory_order_relaxed);
+
+  return true;
+}
+
+bool isSupported(const BitmapKernel kernel) {
+#ifdef ISA_UTILS_X86_DISPATCH
+  __builtin_cpu_init();
+  switch ( kernel ) {
+    case BitmapKernel::AVX512:
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vpopcntdq");
+    case BitmapKernel::AVX2:
+      return __builtin_cpu_supports("avx2");
+    default:
+      return true;
+  }
+#else
+  return kernel == BitmapKernel::Scalar;
+#endif
+}
+
+std::string toString(const BitmapKernel kernel) {
+  switch ( kernel ) {
+    case BitmapKernel::AVX2:
+      return "AVX2";
+    case BitmapKernel::AVX512:
+      return "AVX-512";
+    default:
+      return "scalar";
+  }
+}
+
+void applyMask(const Bitmap & mask, float * data, const float value) {
+  std::size_t sample = 0;
+
+#ifdef ISA_UTILS_X86_DISPATCH
+  const unsigned char * flags = reinterpret_cast<const unsigned char *>(mask.data());
+
+  switch ( getBitmapKernel() ) {
+    case BitmapKernel::AVX512:
+      sample = applyMaskAVX512(flags, data, mask.getNrBits(), value);
+      break;
+    case BitmapKernel::AVX2:
+      sample = applyMaskAVX2(flags, data, mask.getNrBits(), value);
+      break;
+    default:
+      break;
+  }
+#endif
+  // Only the flagged samples are visited in the remaining part
+  for ( std::size_t bit = (sample == 0) ? mask.findFirst() : mask.findNext(sample - 1); bit != Bitmap::npos; bit = mask.findNext(bit) ) {
+    data[bit] = value;
+  }
+}
+
+std::size_t compact(const Bitmap & mask, const float * input, float * output) {
+  std::size_t sample = 0;
+  std::size_t nrKept = 0;
+
+#ifdef ISA_UTILS_X86_DISPATCH
+  const unsigned char * flags = reinterpret_cast<const unsigned char *>(mask.data());
+
+  switch ( getBitmapKernel() ) {
+    case BitmapKernel::AVX512:
+      sample = compactAVX512(flags, input, output, mask.getNrBits(), nrKept);
+      break;
+    case BitmapKernel::AVX2:
+      sample = compactAVX2(flags, input, output, mask.getNrBits(), nrKept);
+      break;
+    default:
+      break;
+  }
+#endif
+  for ( ; sample < mask.getNrBits(); sample++ ) {
+    if ( !mask.test(sample) ) {
+      output[nrKept++] = input[sample];
+    }
+  }
+
+  return nrKept;
+}
+
+} // utils
+} // isa
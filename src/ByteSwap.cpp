@@ -0,0 +1,230 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ByteSwap.hpp>
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ISA_UTILS_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+template<std::size_t Width> struct Swapper;
+
+template<> struct Swapper<2> {
+  static inline void swap(const unsigned char * input, unsigned char * output) {
+    std::uint16_t value;
+
+    std::memcpy(&value, input, sizeof(value));
+    value = __builtin_bswap16(value);
+    std::memcpy(output, &value, sizeof(value));
+  }
+};
+
+template<> struct Swapper<4> {
+  static inline void swap(const unsigned char * input, unsigned char * output) {
+    std::uint32_t value;
+
+    std::memcpy(&value, input, sizeof(value));
+    value = __builtin_bswap32(value);
+    std::memcpy(output, &value, sizeof(value));
+  }
+};
+
+template<> struct Swapper<8> {
+  static inline void swap(const unsigned char * input, unsigned char * output) {
+    std::uint64_t value;
+
+    std::memcpy(&value, input, sizeof(value));
+    value = __builtin_bswap64(value);
+    std::memcpy(output, &value, sizeof(value));
+  }
+};
+
+template<std::size_t Width> void swapScalar(const unsigned char * input, unsigned char * output, const std::size_t nrElements) {
+  for ( std::size_t element = 0; element < nrElements; element++ ) {
+    Swapper<Width>::swap(input + (element * Width), output + (element * Width));
+  }
+}
+
+#ifdef ISA_UTILS_X86_DISPATCH
+// Shuffle control that reverses the bytes inside every element, repeated for the 64 bytes of an AVX-512 register
+template<std::size_t Width> struct ShuffleMask {
+  alignas(64) unsigned char control[64];
+
+  ShuffleMask() {
+    for ( std::size_t byte = 0; byte < 64; byte++ ) {
+      std::size_t lane = byte % 16;
+
+      control[byte] = static_cast<unsigned char>((lane - (lane % Width)) + (Width - 1 - (lane % Width)));
+    }
+  }
+};
+
+// The kernels return the number of bytes processed, always a multiple of their register size
+__attribute__((target("ssse3"))) std::size_t swapSSSE3(const unsigned char * input, unsigned char * output, const std::size_t nrBytes, const unsigned char * control) {
+  const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i *>(control));
+  std::size_t byte = 0;
+
+  for ( ; byte + 16 <= nrBytes; byte += 16 ) {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + byte));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + byte), _mm_shuffle_epi8(value, mask));
+  }
+
+  return byte;
+}
+
+__attribute__((target("avx2"))) std::size_t swapAVX2(const unsigned char * input, unsigned char * output, const std::size_t nrBytes, const unsigned char * control) {
+  const __m256i mask = _mm256_load_si256(reinterpret_cast<const __m256i *>(control));
+  std::size_t byte = 0;
+
+  for ( ; byte + 64 <= nrBytes; byte += 64 ) {
+    __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + byte));
+    __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + byte + 32));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + byte), _mm256_shuffle_epi8(first, mask));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + byte + 32), _mm256_shuffle_epi8(second, mask));
+  }
+  for ( ; byte + 32 <= nrBytes; byte += 32 ) {
+    __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + byte));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + byte), _mm256_shuffle_epi8(value, mask));
+  }
+
+  return byte;
+}
+
+__attribute__((target("avx512f,avx512bw"))) std::size_t swapAVX512(const unsigned char * input, unsigned char * output, const std::size_t nrBytes, const unsigned char * control) {
+  const __m512i mask = _mm512_load_si512(control);
+  std::size_t byte = 0;
+
+  for ( ; byte + 64 <= nrBytes; byte += 64 ) {
+    __m512i value = _mm512_loadu_si512(input + byte);
+    _mm512_storeu_si512(output + byte, _mm512_shuffle_epi8(value, mask));
+  }
+
+  return byte;
+}
+#endif // ISA_UTILS_X86_DISPATCH
+
+ByteSwapKernel selectKernel() {
+  for ( auto kernel : {ByteSwapKernel::AVX512, ByteSwapKernel::AVX2, ByteSwapKernel::SSSE3} ) {
+    if ( isSupported(kernel) ) {
+      return kernel;
+    }
+  }
+  return ByteSwapKernel::Scalar;
+}
+
+std::atomic<ByteSwapKernel> & selectedKernel() {
+  static std::atomic<ByteSwapKernel> kernel(selectKernel());
+
+  return kernel;
+}
+
+template<std::size_t Width> void swap(const void * input, void * output, const std::size_t nrElements) {
+  const unsigned char * in = static_cast<const unsigned char *>(input);
+  unsigned char * out = static_cast<unsigned char *>(output);
+  std::size_t nrBytes = 0;
+
+#ifdef ISA_UTILS_X86_DISPATCH
+  static const ShuffleMask<Width> mask;
+
+  switch ( getByteSwapKernel() ) {
+    case ByteSwapKernel::AVX512:
+      nrBytes = swapAVX512(in, out, nrElements * Width, mask.control);
+      break;
+    case ByteSwapKernel::AVX2:
+      nrBytes = swapAVX2(in, out, nrElements * Width, mask.control);
+      break;
+    case ByteSwapKernel::SSSE3:
+      nrBytes = swapSSSE3(in, out, nrElements * Width, mask.control);
+      break;
+    default:
+      break;
+  }
+#endif
+  swapScalar<Width>(in + nrBytes, out + nrBytes, nrElements - (nrBytes / Width));
+}
+
+} // (anonymous)
+
+ByteSwapKernel getByteSwapKernel() {
+  return selectedKernel().load(std::memory_order_relaxed);
+}
+
+bool setByteSwapKernel(const ByteSwapKernel kernel) {
+  if ( !isSupported(kernel) ) {
+    return false;
+  }
+  selectedKernel().store(kernel, std::memory_order_relaxed);
+
+  return true;
+}
+
+bool isSupported(const ByteSwapKernel kernel) {
+#ifdef ISA_UTILS_X86_DISPATCH
+  __builtin_cpu_init();
+  switch ( kernel ) {
+    case ByteSwapKernel::AVX512:
+      return __builtin_cpu_supports("avx512bw");
+    case ByteSwapKernel::AVX2:
+      return __builtin_cpu_supports("avx2");
+    case ByteSwapKernel::SSSE3:
+      return __builtin_cpu_supports("ssse3");
+    default:
+      return true;
+  }
+#else
+  return kernel == ByteSwapKernel::Scalar;
+#endif
+}
+
+std::string toString(const ByteSwapKernel kernel) {
+  switch ( kernel ) {
+    case ByteSwapKernel::SSSE3:
+      return "SSSE3";
+    case ByteSwapKernel::AVX2:
+      return "AVX2";
+    case ByteSwapKernel::AVX512:
+      return "AVX-512";
+    default:
+      return "scalar";
+  }
+}
+
+template<> void byteSwapArray<1>(const void * input, void * output, const std::size_t nrElements) {
+  if ( input != output ) {
+    std::memmove(output, input, nrElements);
+  }
+}
+
+template<> void byteSwapArray<2>(const void * input, void * output, const std::size_t nrElements) {
+  swap<2>(input, output, nrElements);
+}
+
+template<> void byteSwapArray<4>(const void * input, void * output, const std::size_t nrElements) {
+  swap<4>(input, output, nrElements);
+}
+
+template<> void byteSwapArray<8>(const void * input, void * output, const std::size_t nrElements) {
+  swap<8>(input, output, nrElements);
+}
+
+} // utils
+} // isa
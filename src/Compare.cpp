@@ -0,0 +1,453 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Compare.hpp>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ISA_UTILS_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+// Elements are summarized in blocks, computing the ULP distances only when needed; only the blocks containing the first or a new worst mismatch are visited again, element by element
+constexpr std::size_t blockSize = 4096;
+constexpr std::uint64_t nanULP = std::numeric_limits<std::uint64_t>::max();
+
+struct BlockSummary {
+  std::size_t nrMismatches = 0;
+  double maxAbsolute = 0.0;
+  double maxRelative = 0.0;
+  std::uint64_t maxULP = 0;
+};
+
+template<typename T> struct Bits;
+
+template<> struct Bits<float> {
+  using Type = std::int32_t;
+};
+
+template<> struct Bits<double> {
+  using Type = std::int64_t;
+};
+
+// Map the bits of a value to integers with the same order of the values, with both zeros mapped to zero
+template<typename T> inline typename Bits<T>::Type ordered(const T value) {
+  using Integer = typename Bits<T>::Type;
+  Integer bits;
+
+  std::memcpy(&bits, &value, sizeof(bits));
+  if ( bits < 0 ) {
+    return static_cast<Integer>(static_cast<typename std::make_unsigned<Integer>::type>(std::numeric_limits<Integer>::min()) - static_cast<typename std::make_unsigned<Integer>::type>(bits));
+  }
+
+  return bits;
+}
+
+template<typename T> inline std::uint64_t ulpDistance(const T result, const T expected) {
+  const std::int64_t left = ordered(result);
+  const std::int64_t right = ordered(expected);
+
+  return (left > right) ? static_cast<std::uint64_t>(left) - static_cast<std::uint64_t>(right) : static_cast<std::uint64_t>(right) - static_cast<std::uint64_t>(left);
+}
+
+template<typename T> struct ElementError {
+  bool same;
+  T absolute;
+  T relative;
+  std::uint64_t ulp;
+};
+
+template<typename T> inline ElementError<T> elementError(const T result, const T expected) {
+  ElementError<T> error;
+
+  error.same = (result == expected) || (std::isnan(result) && std::isnan(expected));
+  if ( error.same ) {
+    error.absolute = 0;
+    error.relative = 0;
+    error.ulp = 0;
+  } else if ( std::isnan(result) || std::isnan(expected) ) {
+    error.absolute = std::numeric_limits<T>::infinity();
+    error.relative = std::numeric_limits<T>::infinity();
+    error.ulp = nanULP;
+  } else {
+    error.absolute = std::abs(result - expected);
+    error.relative = std::isinf(error.absolute) ? std::numeric_limits<T>::infinity() : error.absolute / std::abs(expected);
+    error.ulp = ulpDistance(result, expected);
+  }
+
+  return error;
+}
+
+// The thresholds are converted once, so that the scalar and vector kernels take the same decisions
+template<typename T> struct Thresholds {
+  ToleranceMode mode;
+  T value;
+  std::uint64_t ulp;
+
+  explicit Thresholds(const Tolerance & tolerance) : mode(tolerance.mode), value(static_cast<T>(tolerance.value)) {
+    if ( tolerance.value < 0.0 ) {
+      ulp = 0;
+    } else if ( tolerance.value >= 18446744073709551615.0 ) {
+      ulp = nanULP;
+    } else {
+      ulp = static_cast<std::uint64_t>(tolerance.value);
+    }
+  }
+};
+
+template<typename T> inline bool isMismatch(const ElementError<T> & error, const Thresholds<T> & thresholds) {
+  if ( error.same ) {
+    return false;
+  }
+  switch ( thresholds.mode ) {
+    case ToleranceMode::Relative:
+      return !(error.relative < thresholds.value);
+    case ToleranceMode::ULP:
+      return error.ulp > thresholds.ulp;
+    default:
+      return !(error.absolute < thresholds.value);
+  }
+}
+
+template<typename T> inline double metric(const ElementError<T> & error, const ToleranceMode mode) {
+  switch ( mode ) {
+    case ToleranceMode::Relative:
+      return error.relative;
+    case ToleranceMode::ULP:
+      return static_cast<double>(error.ulp);
+    default:
+      return error.absolute;
+  }
+}
+
+template<typename T> void summarizeScalar(const T * result, const T * expected, const std::size_t nrElements, const Thresholds<T> & thresholds, BlockSummary & summary) {
+  for ( std::size_t element = 0; element < nrElements; element++ ) {
+    ElementError<T> error = elementError(result[element], expected[element]);
+
+    summary.nrMismatches += isMismatch(error, thresholds) ? 1 : 0;
+    summary.maxAbsolute = (error.absolute > summary.maxAbsolute) ? error.absolute : summary.maxAbsolute;
+    summary.maxRelative = (error.relative > summary.maxRelative) ? error.relative : summary.maxRelative;
+    if ( thresholds.mode == ToleranceMode::ULP ) {
+      summary.maxULP = (error.ulp > summary.maxULP) ? error.ulp : summary.maxULP;
+    }
+  }
+}
+
+#ifdef ISA_UTILS_X86_DISPATCH
+__attribute__((target("avx2"))) inline double horizontalMax(const __m256 values) {
+  __m128 maximum = _mm_max_ps(_mm256_castps256_ps128(values), _mm256_extractf128_ps(values, 1));
+
+  maximum = _mm_max_ps(maximum, _mm_movehl_ps(maximum, maximum));
+  maximum = _mm_max_ss(maximum, _mm_shuffle_ps(maximum, maximum, 1));
+
+  return _mm_cvtss_f32(maximum);
+}
+
+__attribute__((target("avx2"))) inline double horizontalMax(const __m256d values) {
+  __m128d maximum = _mm_max_pd(_mm256_castpd256_pd128(values), _mm256_extractf128_pd(values, 1));
+
+  return _mm_cvtsd_f64(_mm_max_sd(maximum, _mm_unpackhi_pd(maximum, maximum)));
+}
+
+// Mismatched NaNs have infinite absolute and relative errors, and all bits set in the ULP distance; NaN relative errors, i.e. 0 / 0 or infinity / infinity,
+// never become the maximum, as in the scalar kernel
+template<ToleranceMode Mode> __attribute__((target("avx2"))) std::size_t summarizeAVX2(const float * result, const float * expected, const std::size_t nrElements, const Thresholds<float> & thresholds, BlockSummary & summary) {
+  const __m256 signMask = _mm256_set1_ps(-0.0f);
+  const __m256d signMaskDouble = _mm256_set1_pd(-0.0);
+  const __m256 infinity = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+  const __m256d infinityDouble = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+  const __m256i minimum = _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min());
+  const __m256 threshold = _mm256_set1_ps(thresholds.value);
+  const __m256d ulpThreshold = _mm256_set1_pd(static_cast<double>(thresholds.ulp));
+  __m256 maxAbsolute = _mm256_setzero_ps();
+  __m256 maxRelative = _mm256_setzero_ps();
+  __m256d maxULP = _mm256_setzero_pd();
+  std::size_t element = 0;
+
+  for ( ; element + 8 <= nrElements; element += 8 ) {
+    const __m256 left = _mm256_loadu_ps(result + element);
+    const __m256 right = _mm256_loadu_ps(expected + element);
+    const __m256 leftNaN = _mm256_cmp_ps(left, left, _CMP_UNORD_Q);
+    const __m256 rightNaN = _mm256_cmp_ps(right, right, _CMP_UNORD_Q);
+    const __m256 anyNaN = _mm256_or_ps(leftNaN, rightNaN);
+    const __m256 same = _mm256_or_ps(_mm256_cmp_ps(left, right, _CMP_EQ_OQ), _mm256_and_ps(leftNaN, rightNaN));
+    __m256 absolute = _mm256_blendv_ps(_mm256_andnot_ps(signMask, _mm256_sub_ps(left, right)), infinity, anyNaN);
+    __m256 relative = _mm256_blendv_ps(_mm256_div_ps(absolute, _mm256_andnot_ps(signMask, right)), infinity, _mm256_cmp_ps(absolute, infinity, _CMP_EQ_OQ));
+    int mismatches = 0;
+
+    absolute = _mm256_andnot_ps(same, absolute);
+    relative = _mm256_andnot_ps(same, relative);
+    int ulpMismatches = 0;
+
+    if ( Mode == ToleranceMode::ULP ) {
+      // The ULP distance of two floats always fits exactly in a double
+      __m256i leftBits = _mm256_castps_si256(left);
+      __m256i rightBits = _mm256_castps_si256(right);
+      __m256i leftOrdered = _mm256_blendv_epi8(leftBits, _mm256_sub_epi32(minimum, leftBits), _mm256_cmpgt_epi32(_mm256_setzero_si256(), leftBits));
+      __m256i rightOrdered = _mm256_blendv_epi8(rightBits, _mm256_sub_epi32(minimum, rightBits), _mm256_cmpgt_epi32(_mm256_setzero_si256(), rightBits));
+      __m256i anyNaNBits = _mm256_castps_si256(anyNaN);
+      __m256i sameBits = _mm256_castps_si256(same);
+
+      for ( unsigned int half = 0; half < 2; half++ ) {
+        __m128i leftHalf = half == 0 ? _mm256_castsi256_si128(leftOrdered) : _mm256_extracti128_si256(leftOrdered, 1);
+        __m128i rightHalf = half == 0 ? _mm256_castsi256_si128(rightOrdered) : _mm256_extracti128_si256(rightOrdered, 1);
+        __m256d halfNaN = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(half == 0 ? _mm256_castsi256_si128(anyNaNBits) : _mm256_extracti128_si256(anyNaNBits, 1)));
+        __m256d halfSame = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(half == 0 ? _mm256_castsi256_si128(sameBits) : _mm256_extracti128_si256(sameBits, 1)));
+        __m256d ulp = _mm256_andnot_pd(signMaskDouble, _mm256_sub_pd(_mm256_cvtepi32_pd(leftHalf), _mm256_cvtepi32_pd(rightHalf)));
+
+        ulp = _mm256_andnot_pd(halfSame, _mm256_blendv_pd(ulp, infinityDouble, halfNaN));
+        maxULP = _mm256_max_pd(ulp, maxULP);
+        ulpMismatches |= _mm256_movemask_pd(_mm256_cmp_pd(ulp, ulpThreshold, _CMP_GT_OQ)) << (half * 4);
+      }
+    }
+    switch ( Mode ) {
+      case ToleranceMode::Relative:
+        mismatches = _mm256_movemask_ps(_mm256_andnot_ps(same, _mm256_cmp_ps(relative, threshold, _CMP_NLT_UQ)));
+        break;
+      case ToleranceMode::ULP:
+        mismatches = ulpMismatches;
+        break;
+      default:
+        mismatches = _mm256_movemask_ps(_mm256_andnot_ps(same, _mm256_cmp_ps(absolute, threshold, _CMP_NLT_UQ)));
+        break;
+    }
+    summary.nrMismatches += __builtin_popcount(mismatches);
+    maxAbsolute = _mm256_max_ps(absolute, maxAbsolute);
+    maxRelative = _mm256_max_ps(relative, maxRelative);
+  }
+  double maximum = horizontalMax(maxULP);
+
+  summary.maxAbsolute = horizontalMax(maxAbsolute);
+  summary.maxRelative = horizontalMax(maxRelative);
+  summary.maxULP = (maximum == std::numeric_limits<double>::infinity()) ? nanULP : static_cast<std::uint64_t>(maximum);
+
+  return element;
+}
+
+template<ToleranceMode Mode> __attribute__((target("avx2"))) std::size_t summarizeAVX2(const double * result, const double * expected, const std::size_t nrElements, const Thresholds<double> & thresholds, BlockSummary & summary) {
+  const __m256d signMask = _mm256_set1_pd(-0.0);
+  const __m256d infinity = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+  const __m256i minimum = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+  const __m256d threshold = _mm256_set1_pd(thresholds.value);
+  // Unsigned comparisons are signed comparisons after flipping the sign bit
+  const __m256i ulpThreshold = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<std::int64_t>(thresholds.ulp)), minimum);
+  __m256d maxAbsolute = _mm256_setzero_pd();
+  __m256d maxRelative = _mm256_setzero_pd();
+  __m256i maxULPFlipped = minimum;
+  std::size_t element = 0;
+
+  for ( ; element + 4 <= nrElements; element += 4 ) {
+    const __m256d left = _mm256_loadu_pd(result + element);
+    const __m256d right = _mm256_loadu_pd(expected + element);
+    const __m256d leftNaN = _mm256_cmp_pd(left, left, _CMP_UNORD_Q);
+    const __m256d rightNaN = _mm256_cmp_pd(right, right, _CMP_UNORD_Q);
+    const __m256d anyNaN = _mm256_or_pd(leftNaN, rightNaN);
+    const __m256d same = _mm256_or_pd(_mm256_cmp_pd(left, right, _CMP_EQ_OQ), _mm256_and_pd(leftNaN, rightNaN));
+    __m256d absolute = _mm256_blendv_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(left, right)), infinity, anyNaN);
+    __m256d relative = _mm256_blendv_pd(_mm256_div_pd(absolute, _mm256_andnot_pd(signMask, right)), infinity, _mm256_cmp_pd(absolute, infinity, _CMP_EQ_OQ));
+    int mismatches = 0;
+
+    absolute = _mm256_andnot_pd(same, absolute);
+    relative = _mm256_andnot_pd(same, relative);
+    __m256i ulpFlipped = minimum;
+
+    if ( Mode == ToleranceMode::ULP ) {
+      __m256i leftBits = _mm256_castpd_si256(left);
+      __m256i rightBits = _mm256_castpd_si256(right);
+      __m256i leftOrdered = _mm256_blendv_epi8(leftBits, _mm256_sub_epi64(minimum, leftBits), _mm256_cmpgt_epi64(_mm256_setzero_si256(), leftBits));
+      __m256i rightOrdered = _mm256_blendv_epi8(rightBits, _mm256_sub_epi64(minimum, rightBits), _mm256_cmpgt_epi64(_mm256_setzero_si256(), rightBits));
+      __m256i ulp = _mm256_blendv_epi8(_mm256_sub_epi64(rightOrdered, leftOrdered), _mm256_sub_epi64(leftOrdered, rightOrdered), _mm256_cmpgt_epi64(leftOrdered, rightOrdered));
+
+      ulp = _mm256_andnot_si256(_mm256_castpd_si256(same), _mm256_or_si256(ulp, _mm256_castpd_si256(anyNaN)));
+      ulpFlipped = _mm256_xor_si256(ulp, minimum);
+      maxULPFlipped = _mm256_blendv_epi8(maxULPFlipped, ulpFlipped, _mm256_cmpgt_epi64(ulpFlipped, maxULPFlipped));
+    }
+    switch ( Mode ) {
+      case ToleranceMode::Relative:
+        mismatches = _mm256_movemask_pd(_mm256_andnot_pd(same, _mm256_cmp_pd(relative, threshold, _CMP_NLT_UQ)));
+        break;
+      case ToleranceMode::ULP:
+        mismatches = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(ulpFlipped, ulpThreshold)));
+        break;
+      default:
+        mismatches = _mm256_movemask_pd(_mm256_andnot_pd(same, _mm256_cmp_pd(absolute, threshold, _CMP_NLT_UQ)));
+        break;
+    }
+    summary.nrMismatches += __builtin_popcount(mismatches);
+    maxAbsolute = _mm256_max_pd(absolute, maxAbsolute);
+    maxRelative = _mm256_max_pd(relative, maxRelative);
+  }
+  alignas(32) std::uint64_t lanes[4];
+
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), _mm256_xor_si256(maxULPFlipped, minimum));
+  summary.maxAbsolute = horizontalMax(maxAbsolute);
+  summary.maxRelative = horizontalMax(maxRelative);
+  summary.maxULP = 0;
+  for ( auto lane : lanes ) {
+    summary.maxULP = (lane > summary.maxULP) ? lane : summary.maxULP;
+  }
+
+  return element;
+}
+#endif // ISA_UTILS_X86_DISPATCH
+
+CompareKernel selectKernel() {
+#ifdef ISA_UTILS_X86_DISPATCH
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("avx2") ) {
+    return CompareKernel::AVX2;
+  }
+#endif
+  return CompareKernel::Scalar;
+}
+
+template<typename T> void summarize(const T * result, const T * expected, const std::size_t nrElements, const Thresholds<T> & thresholds, BlockSummary & summary) {
+  std::size_t element = 0;
+
+#ifdef ISA_UTILS_X86_DISPATCH
+  if ( getCompareKernel() == CompareKernel::AVX2 ) {
+    switch ( thresholds.mode ) {
+      case ToleranceMode::Relative:
+        element = summarizeAVX2<ToleranceMode::Relative>(result, expected, nrElements, thresholds, summary);
+        break;
+      case ToleranceMode::ULP:
+        element = summarizeAVX2<ToleranceMode::ULP>(result, expected, nrElements, thresholds, summary);
+        break;
+      default:
+        element = summarizeAVX2<ToleranceMode::Absolute>(result, expected, nrElements, thresholds, summary);
+        break;
+    }
+  }
+#endif
+  summarizeScalar(result + element, expected + element, nrElements - element, thresholds, summary);
+}
+
+template<typename T> void compareRange(const T * result, const T * expected, const std::size_t first, const std::size_t last, const Tolerance & tolerance, ComparisonResult & comparison) {
+  const Thresholds<T> thresholds(tolerance);
+
+  for ( std::size_t block = first; block < last; block += blockSize ) {
+    const std::size_t nrElements = (last - block < blockSize) ? last - block : blockSize;
+    BlockSummary summary;
+
+    summarize(result + block, expected + block, nrElements, thresholds, summary);
+    comparison.maxAbsoluteError = (summary.maxAbsolute > comparison.maxAbsoluteError) ? summary.maxAbsolute : comparison.maxAbsoluteError;
+    comparison.maxRelativeError = (summary.maxRelative > comparison.maxRelativeError) ? summary.maxRelative : comparison.maxRelativeError;
+    comparison.maxULPError = (summary.maxULP > comparison.maxULPError) ? summary.maxULP : comparison.maxULPError;
+    if ( summary.nrMismatches == 0 ) {
+      continue;
+    }
+    comparison.nrMismatches += summary.nrMismatches;
+    // Mismatches have the largest errors of their block
+    double blockWorst = (tolerance.mode == ToleranceMode::Relative) ? summary.maxRelative : ((tolerance.mode == ToleranceMode::ULP) ? static_cast<double>(summary.maxULP) : summary.maxAbsolute);
+    if ( comparison.firstMismatch != ComparisonResult::npos && !(blockWorst > comparison.worstError) ) {
+      continue;
+    }
+    for ( std::size_t element = block; element < block + nrElements; element++ ) {
+      ElementError<T> error = elementError(result[element], expected[element]);
+
+      if ( !isMismatch(error, thresholds) ) {
+        continue;
+      }
+      if ( comparison.firstMismatch == ComparisonResult::npos ) {
+        comparison.firstMismatch = element;
+        comparison.worstMismatch = element;
+        comparison.worstError = metric(error, tolerance.mode);
+      } else if ( metric(error, tolerance.mode) > comparison.worstError ) {
+        comparison.worstMismatch = element;
+        comparison.worstError = metric(error, tolerance.mode);
+      }
+    }
+  }
+}
+
+} // (anonymous)
+
+constexpr std::size_t ComparisonResult::npos;
+
+template<typename T> ComparisonResult compare(const T * result, const T * expected, const std::size_t nrElements, const Tolerance & tolerance, unsigned int nrThreads) {
+  ComparisonResult comparison;
+
+  comparison.nrElements = nrElements;
+  if ( nrThreads <= 1 || nrElements < (2 * blockSize) ) {
+    compareRange(result, expected, 0, nrElements, tolerance, comparison);
+    return comparison;
+  }
+  // Every thread compares a contiguous range of whole blocks; the partial results are merged in order
+  const std::size_t nrBlocks = (nrElements + blockSize - 1) / blockSize;
+  const std::size_t blocksPerThread = (nrBlocks + nrThreads - 1) / nrThreads;
+  std::vector<ComparisonResult> partials(nrThreads);
+  std::vector<std::thread> threads;
+
+  for ( unsigned int thread = 0; thread < nrThreads; thread++ ) {
+    const std::size_t first = thread * blocksPerThread * blockSize;
+    const std::size_t last = ((first + (blocksPerThread * blockSize)) < nrElements) ? first + (blocksPerThread * blockSize) : nrElements;
+
+    if ( first >= nrElements ) {
+      break;
+    }
+    threads.emplace_back(compareRange<T>, result, expected, first, last, std::cref(tolerance), std::ref(partials.at(thread)));
+  }
+  for ( auto & thread : threads ) {
+    thread.join();
+  }
+  for ( const auto & partial : partials ) {
+    comparison.nrMismatches += partial.nrMismatches;
+    comparison.maxAbsoluteError = (partial.maxAbsoluteError > comparison.maxAbsoluteError) ? partial.maxAbsoluteError : comparison.maxAbsoluteError;
+    comparison.maxRelativeError = (partial.maxRelativeError > comparison.maxRelativeError) ? partial.maxRelativeError : comparison.maxRelativeError;
+    comparison.maxULPError = (partial.maxULPError > comparison.maxULPError) ? partial.maxULPError : comparison.maxULPError;
+    if ( partial.firstMismatch == ComparisonResult::npos ) {
+      continue;
+    }
+    if ( comparison.firstMismatch == ComparisonResult::npos ) {
+      comparison.firstMismatch = partial.firstMismatch;
+      comparison.worstMismatch = partial.worstMismatch;
+      comparison.worstError = partial.worstError;
+    } else if ( partial.worstError > comparison.worstError ) {
+      comparison.worstMismatch = partial.worstMismatch;
+      comparison.worstError = partial.worstError;
+    }
+  }
+
+  return comparison;
+}
+
+CompareKernel getCompareKernel() {
+  static const CompareKernel kernel = selectKernel();
+
+  return kernel;
+}
+
+std::string toString(const CompareKernel kernel) {
+  switch ( kernel ) {
+    case CompareKernel::AVX2:
+      return "AVX2";
+    default:
+      return "scalar";
+  }
+}
+
+template ComparisonResult compare<float>(const float * result, const float * expected, std::size_t nrElements, const Tolerance & tolerance, unsigned int nrThreads);
+template ComparisonResult compare<double>(const double * result, const double * expected, std::size_t nrElements, const Tolerance & tolerance, unsigned int nrThreads);
+
+} // utils
+} // isa
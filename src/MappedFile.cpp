@@ -0,0 +1,130 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <MappedFile.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace isa {
+namespace utils {
+
+MappedFileError::MappedFileError(const std::string & message) : errorMessage(message) {}
+
+const char * MappedFileError::what() const noexcept {
+  return this->errorMessage.c_str();
+}
+
+MappedFile::MappedFile(const std::string & path) : path(path), data(nullptr), size(0) {
+  int descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  struct stat status;
+
+  if ( descriptor < 0 ) {
+    throw MappedFileError("ERROR: impossible to open \"" + path + "\": " + std::strerror(errno));
+  }
+  if ( fstat(descriptor, &status) != 0 ) {
+    std::string error = std::strerror(errno);
+
+    close(descriptor);
+    throw MappedFileError("ERROR: impossible to stat \"" + path + "\": " + error);
+  }
+  size = static_cast<std::size_t>(status.st_size);
+  if ( size > 0 ) {
+    // MAP_NORESERVE: nothing is reserved in swap, pages are only backed by the file
+    void * mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED | MAP_NORESERVE, descriptor, 0);
+
+    if ( mapping == MAP_FAILED ) {
+      std::string error = std::strerror(errno);
+
+      close(descriptor);
+      throw MappedFileError("ERROR: impossible to map \"" + path + "\": " + error);
+    }
+    data = static_cast<unsigned char *>(mapping);
+  }
+  // The mapping keeps a reference to the file
+  close(descriptor);
+}
+
+MappedFile::~MappedFile() {
+  if ( data != nullptr ) {
+    munmap(data, size);
+  }
+}
+
+MappedFile::MappedFile(MappedFile && other) noexcept : path(std::move(other.path)), data(other.data), size(other.size) {
+  other.data = nullptr;
+  other.size = 0;
+}
+
+MappedFile & MappedFile::operator=(MappedFile && other) noexcept {
+  if ( this != &other ) {
+    if ( data != nullptr ) {
+      munmap(data, size);
+    }
+    path = std::move(other.path);
+    data = other.data;
+    size = other.size;
+    other.data = nullptr;
+    other.size = 0;
+  }
+
+  return *this;
+}
+
+bool MappedFile::advise(const AccessPattern pattern) {
+  return advise(pattern, 0, size);
+}
+
+bool MappedFile::advise(const AccessPattern pattern, const std::size_t offset, const std::size_t length) {
+  int advice = MADV_NORMAL;
+  const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+  if ( data == nullptr || offset >= size ) {
+    return false;
+  }
+  switch ( pattern ) {
+    case AccessPattern::Sequential:
+      advice = MADV_SEQUENTIAL;
+      break;
+    case AccessPattern::Random:
+      advice = MADV_RANDOM;
+      break;
+    case AccessPattern::WillNeed:
+      advice = MADV_WILLNEED;
+      break;
+    case AccessPattern::DontNeed:
+      advice = MADV_DONTNEED;
+      break;
+    case AccessPattern::HugePage:
+#ifdef MADV_HUGEPAGE
+      advice = MADV_HUGEPAGE;
+      break;
+#else
+      return false;
+#endif
+    default:
+      break;
+  }
+  // madvise() requires a page aligned address
+  std::size_t first = offset - (offset % pageSize);
+  std::size_t last = offset + std::min(length, size - offset);
+
+  return madvise(data + first, last - first, advice) == 0;
+}
+
+} // utils
+} // isa
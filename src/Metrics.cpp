@@ -0,0 +1,208 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Metrics.hpp>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <cstdio>
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+std::string escape(const std::string & text) {
+  std::string escaped;
+
+  for ( auto character : text ) {
+    if ( character == '"' || character == '\\' ) {
+      escaped.push_back('\\');
+    } else if ( character == '\n' ) {
+      escaped.append("\\n");
+      continue;
+    }
+    escaped.push_back(character);
+  }
+
+  return escaped;
+}
+
+// RFC 4180: quotes inside a quoted field are doubled
+std::string escapeCSV(const std::string & text) {
+  std::string escaped;
+
+  for ( auto character : text ) {
+    if ( character == '"' ) {
+      escaped.push_back('"');
+    }
+    escaped.push_back(character);
+  }
+
+  return escaped;
+}
+
+void writeCSV(std::ostream & output, const double timestamp, const std::vector<std::pair<std::string, MetricSnapshot>> & metrics, const bool header) {
+  if ( header ) {
+    output << "timestamp,name,count,total,mean,stddev,min,max" << std::endl;
+  }
+  for ( const auto & metric : metrics ) {
+    output << timestamp << ",\"" << escapeCSV(metric.first) << "\"," << metric.second.nrElements << "," << metric.second.total << "," << metric.second.mean << ",";
+    output << metric.second.standardDeviation << "," << metric.second.min << "," << metric.second.max << std::endl;
+  }
+}
+
+void writeJSONLines(std::ostream & output, const double timestamp, const std::vector<std::pair<std::string, MetricSnapshot>> & metrics) {
+  for ( const auto & metric : metrics ) {
+    output << "{\"timestamp\":" << timestamp << ",\"name\":\"" << escape(metric.first) << "\",\"count\":" << metric.second.nrElements;
+    output << ",\"total\":" << metric.second.total << ",\"mean\":" << metric.second.mean << ",\"stddev\":" << metric.second.standardDeviation;
+    output << ",\"min\":" << metric.second.min << ",\"max\":" << metric.second.max << "}" << std::endl;
+  }
+}
+
+void writePrometheusFamily(std::ostream & output, const std::string & family, const std::vector<std::pair<std::string, MetricSnapshot>> & metrics, double MetricSnapshot::* field) {
+  output << "# TYPE isa_utils_metric_" << family << " gauge" << std::endl;
+  for ( const auto & metric : metrics ) {
+    output << "isa_utils_metric_" << family << "{name=\"" << escape(metric.first) << "\"} " << metric.second.*field << std::endl;
+  }
+}
+
+void writePrometheus(std::ostream & output, const std::vector<std::pair<std::string, MetricSnapshot>> & metrics) {
+  output << "# TYPE isa_utils_metric_count gauge" << std::endl;
+  for ( const auto & metric : metrics ) {
+    output << "isa_utils_metric_count{name=\"" << escape(metric.first) << "\"} " << metric.second.nrElements << std::endl;
+  }
+  writePrometheusFamily(output, "total", metrics, &MetricSnapshot::total);
+  writePrometheusFamily(output, "mean", metrics, &MetricSnapshot::mean);
+  writePrometheusFamily(output, "stddev", metrics, &MetricSnapshot::standardDeviation);
+  writePrometheusFamily(output, "min", metrics, &MetricSnapshot::min);
+  writePrometheusFamily(output, "max", metrics, &MetricSnapshot::max);
+}
+
+} // (anonymous)
+
+MetricSlot::MetricSlot() : sequence(0), nrElements(0), total(0.0), mean(0.0), standardDeviation(0.0), min(0.0), max(0.0) {}
+
+MetricSlot & MetricsRegistry::getSlot(const std::string & name) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto & slot = slots[name];
+
+  if ( !slot ) {
+    slot.reset(new MetricSlot());
+  }
+
+  return *slot;
+}
+
+std::vector<std::pair<std::string, MetricSnapshot>> MetricsRegistry::snapshot() const {
+  std::vector<std::pair<std::string, MetricSnapshot>> metrics;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  metrics.reserve(slots.size());
+  for ( const auto & slot : slots ) {
+    metrics.emplace_back(slot.first, slot.second->read());
+  }
+
+  return metrics;
+}
+
+MetricsExporter::MetricsExporter(const MetricsRegistry & registry, const std::string & path, const MetricsFormat format, const std::chrono::milliseconds interval) : registry(registry), path(path), format(format), interval(interval), running(false), headerWritten(false), nrExports(0), nrErrors(0) {}
+
+MetricsExporter::~MetricsExporter() {
+  stop();
+}
+
+void MetricsExporter::start() {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if ( running ) {
+    return;
+  }
+  running = true;
+  worker = std::thread(&MetricsExporter::run, this);
+}
+
+void MetricsExporter::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if ( !running ) {
+      return;
+    }
+    running = false;
+  }
+  wakeUp.notify_all();
+  worker.join();
+  exportNow();
+}
+
+bool MetricsExporter::exportNow() {
+  std::lock_guard<std::mutex> lock(outputMutex);
+  auto metrics = registry.snapshot();
+  double timestamp = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::system_clock::now().time_since_epoch()).count();
+  bool written = false;
+
+  if ( format == MetricsFormat::Prometheus ) {
+    // Write a temporary file and rename it, so that scrapers never see a partial file
+    std::string temporary = path + ".tmp";
+    std::ofstream output(temporary, std::ios::trunc);
+
+    output << std::setprecision(std::numeric_limits<double>::max_digits10);
+    writePrometheus(output, metrics);
+    output.close();
+    written = output.good() && (std::rename(temporary.c_str(), path.c_str()) == 0);
+  } else {
+    std::ofstream output(path, std::ios::app);
+
+    output << std::setprecision(std::numeric_limits<double>::max_digits10);
+    if ( format == MetricsFormat::CSV ) {
+      if ( !headerWritten ) {
+        // Appending to a file written by a previous exporter, that already has a header
+        std::ifstream existing(path, std::ios::binary | std::ios::ate);
+
+        headerWritten = existing.is_open() && existing.tellg() > 0;
+      }
+      writeCSV(output, timestamp, metrics, !headerWritten);
+    } else {
+      writeJSONLines(output, timestamp, metrics);
+    }
+    output.close();
+    written = output.good();
+    headerWritten = headerWritten || written;
+  }
+  if ( written ) {
+    nrExports++;
+  } else {
+    nrErrors++;
+  }
+
+  return written;
+}
+
+void MetricsExporter::run() {
+  std::unique_lock<std::mutex> lock(mutex);
+
+  while ( running ) {
+    if ( wakeUp.wait_for(lock, interval, [this]() { return !running; }) ) {
+      break;
+    }
+    lock.unlock();
+    exportNow();
+    lock.lock();
+  }
+}
+
+} // utils
+} // isa
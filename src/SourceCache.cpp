@@ -0,0 +1,262 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <SourceCache.hpp>
+#include <utils.hpp>
+#include <fstream>
+#include <iterator>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+using uint128 = unsigned __int128;
+
+// FNV-1a parameters for 128 bits hashes
+const uint128 fnvOffset = (static_cast<uint128>(0x6c62272e07bb0142ULL) << 64) | 0x62b821756295c58dULL;
+const uint128 fnvPrime = (static_cast<uint128>(0x0000000001000000ULL) << 64) | 0x000000000000013bULL;
+
+inline uint128 hashBytes(uint128 hash, const unsigned char * bytes, const std::size_t nrBytes) {
+  for ( std::size_t byte = 0; byte < nrBytes; byte++ ) {
+    hash ^= bytes[byte];
+    hash *= fnvPrime;
+  }
+  return hash;
+}
+
+// The length is hashed before the content, so that the boundaries between strings are part of the key
+inline uint128 hashString(uint128 hash, const std::string & value) {
+  unsigned char length[8];
+  std::uint64_t size = value.size();
+
+  for ( unsigned int byte = 0; byte < 8; byte++ ) {
+    length[byte] = static_cast<unsigned char>(size >> (byte * 8));
+  }
+  hash = hashBytes(hash, length, 8);
+  return hashBytes(hash, reinterpret_cast<const unsigned char *>(value.data()), value.size());
+}
+
+inline uint128 toHash(const SourceKey & key) {
+  return (static_cast<uint128>(key.high) << 64) | key.low;
+}
+
+inline SourceKey toKey(const uint128 hash) {
+  SourceKey key;
+
+  key.high = static_cast<std::uint64_t>(hash >> 64);
+  key.low = static_cast<std::uint64_t>(hash);
+  return key;
+}
+
+// Distinguishes the temporary files written by different threads of the same process
+std::atomic<std::uint64_t> temporaryCounter(0);
+
+} // (anonymous)
+
+SourceCacheError::SourceCacheError(const std::string & message) : errorMessage(message) {}
+
+const char * SourceCacheError::what() const noexcept {
+  return this->errorMessage.c_str();
+}
+
+std::string SourceKey::toString() const {
+  const char digits[] = "0123456789abcdef";
+  std::string hexadecimal(32, '0');
+
+  for ( unsigned int digit = 0; digit < 16; digit++ ) {
+    hexadecimal.at(15 - digit) = digits[(high >> (digit * 4)) & 0x0f];
+    hexadecimal.at(31 - digit) = digits[(low >> (digit * 4)) & 0x0f];
+  }
+  return hexadecimal;
+}
+
+SourceKey hashTemplate(const std::string & sourceTemplate) {
+  return toKey(hashString(fnvOffset, sourceTemplate));
+}
+
+SourceKey hashSource(const SourceKey & templateKey, const Substitutions & substitutions) {
+  uint128 hash = toHash(templateKey);
+
+  for ( const auto & substitution : substitutions ) {
+    hash = hashString(hash, substitution.first);
+    hash = hashString(hash, substitution.second);
+  }
+  return toKey(hash);
+}
+
+SourceKey hashSource(const std::string & sourceTemplate, const Substitutions & substitutions) {
+  return hashSource(hashTemplate(sourceTemplate), substitutions);
+}
+
+std::string render(const std::string & sourceTemplate, const Substitutions & substitutions) {
+  std::string source(sourceTemplate);
+  std::string buffer;
+
+  // The two strings are swapped after every substitution, so that their capacity is reused
+  for ( const auto & substitution : substitutions ) {
+    replace(source, substitution.first, substitution.second, buffer);
+    source.swap(buffer);
+  }
+  return source;
+}
+
+SourceTemplate::SourceTemplate(std::string source) : source(std::move(source)) {
+  key = hashTemplate(this->source);
+}
+
+SourceCache::SourceCache(const std::size_t capacity, const std::string & directory, unsigned int nrShards) : capacity(capacity), directory(directory), nrHits(0), nrDiskHits(0), nrMisses(0), nrEvictions(0) {
+  if ( nrShards == 0 ) {
+    nrShards = 1;
+  }
+  // Every shard holds at least one source, so there cannot be more shards than sources
+  if ( capacity > 0 && capacity < nrShards ) {
+    nrShards = static_cast<unsigned int>(capacity);
+  }
+  shardCapacity = (capacity + nrShards - 1) / nrShards;
+  for ( unsigned int shard = 0; shard < nrShards; shard++ ) {
+    shards.emplace_back(new Shard());
+  }
+  if ( !directory.empty() ) {
+    struct stat status;
+
+    if ( mkdir(directory.c_str(), 0777) != 0 && errno != EEXIST ) {
+      throw SourceCacheError("ERROR: impossible to create \"" + directory + "\": " + std::strerror(errno));
+    }
+    if ( stat(directory.c_str(), &status) != 0 || !S_ISDIR(status.st_mode) ) {
+      throw SourceCacheError("ERROR: \"" + directory + "\" is not a directory");
+    }
+  }
+}
+
+std::shared_ptr<const std::string> SourceCache::get(const std::string & sourceTemplate, const Substitutions & substitutions) {
+  return get(sourceTemplate, hashSource(sourceTemplate, substitutions), substitutions);
+}
+
+std::shared_ptr<const std::string> SourceCache::get(const SourceTemplate & sourceTemplate, const Substitutions & substitutions) {
+  return get(sourceTemplate.getSource(), hashSource(sourceTemplate.getKey(), substitutions), substitutions);
+}
+
+std::shared_ptr<const std::string> SourceCache::get(const std::string & sourceTemplate, const SourceKey & key, const Substitutions & substitutions) {
+  Shard & shard = *shards.at(key.high % shards.size());
+  std::shared_ptr<const std::string> source = find(shard, key);
+
+  if ( source ) {
+    nrHits.fetch_add(1, std::memory_order_relaxed);
+    return source;
+  }
+  // Sources are read or generated without holding the lock; if two threads miss the same key, both generate it
+  if ( !directory.empty() ) {
+    source = readFile(key);
+    if ( source ) {
+      nrDiskHits.fetch_add(1, std::memory_order_relaxed);
+      return insert(shard, key, source);
+    }
+  }
+  nrMisses.fetch_add(1, std::memory_order_relaxed);
+  source = std::make_shared<const std::string>(render(sourceTemplate, substitutions));
+  if ( !directory.empty() ) {
+    writeFile(key, *source);
+  }
+  return insert(shard, key, source);
+}
+
+void SourceCache::clear() {
+  for ( auto & shard : shards ) {
+    std::lock_guard<std::mutex> guard(shard->lock);
+
+    shard->index.clear();
+    shard->entries.clear();
+  }
+}
+
+std::size_t SourceCache::getNrEntries() const {
+  std::size_t nrEntries = 0;
+
+  for ( auto & shard : shards ) {
+    std::lock_guard<std::mutex> guard(shard->lock);
+
+    nrEntries += shard->entries.size();
+  }
+  return nrEntries;
+}
+
+std::shared_ptr<const std::string> SourceCache::find(Shard & shard, const SourceKey & key) {
+  std::lock_guard<std::mutex> guard(shard.lock);
+  auto item = shard.index.find(key);
+
+  if ( item == shard.index.end() ) {
+    return std::shared_ptr<const std::string>();
+  }
+  // Move the entry in front of the list, without allocating
+  shard.entries.splice(shard.entries.begin(), shard.entries, item->second);
+  return item->second->source;
+}
+
+std::shared_ptr<const std::string> SourceCache::insert(Shard & shard, const SourceKey & key, std::shared_ptr<const std::string> source) {
+  if ( shardCapacity == 0 ) {
+    return source;
+  }
+  std::lock_guard<std::mutex> guard(shard.lock);
+  auto item = shard.index.find(key);
+
+  // Another thread inserted the same source in the meantime
+  if ( item != shard.index.end() ) {
+    shard.entries.splice(shard.entries.begin(), shard.entries, item->second);
+    return item->second->source;
+  }
+  shard.entries.push_front(Entry{key, std::move(source)});
+  shard.index.emplace(key, shard.entries.begin());
+  if ( shard.entries.size() > shardCapacity ) {
+    shard.index.erase(shard.entries.back().key);
+    shard.entries.pop_back();
+    nrEvictions.fetch_add(1, std::memory_order_relaxed);
+  }
+  return shard.entries.front().source;
+}
+
+std::shared_ptr<const std::string> SourceCache::readFile(const SourceKey & key) const {
+  std::ifstream input(directory + "/" + key.toString() + ".src", std::ios::binary);
+
+  if ( !input ) {
+    return std::shared_ptr<const std::string>();
+  }
+  std::string source((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+  if ( input.bad() ) {
+    return std::shared_ptr<const std::string>();
+  }
+  return std::make_shared<const std::string>(std::move(source));
+}
+
+void SourceCache::writeFile(const SourceKey & key, const std::string & source) const {
+  const std::string path = directory + "/" + key.toString() + ".src";
+  const std::string temporaryPath = path + ".tmp." + std::to_string(getpid()) + "." + std::to_string(temporaryCounter.fetch_add(1));
+  std::ofstream output(temporaryPath, std::ios::binary | std::ios::trunc);
+
+  // The on-disk tier is best effort: a source that cannot be stored is generated again next time
+  output.write(source.data(), static_cast<std::streamsize>(source.size()));
+  output.close();
+  if ( !output || std::rename(temporaryPath.c_str(), path.c_str()) != 0 ) {
+    std::remove(temporaryPath.c_str());
+  }
+}
+
+} // utils
+} // isa
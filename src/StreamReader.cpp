@@ -0,0 +1,306 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StreamReader.hpp>
+#include <utils.hpp>
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+// Alignment of the buffers, and granularity of direct I/O
+constexpr std::size_t pageSize = 4096;
+// Marks the end of the stream in the queues
+constexpr unsigned int endOfStream = ~0u;
+
+// Number of times a stage yields, waiting for a queue, before going to sleep
+constexpr unsigned int nrSpins = 64;
+
+} // (anonymous)
+
+StreamError::StreamError(const std::string & message) : errorMessage(message) {}
+
+const char * StreamError::what() const noexcept {
+  return this->errorMessage.c_str();
+}
+
+StreamReader::StreamReader(const std::string & path, const std::size_t blockSize, const unsigned int nrBuffers, const bool directIO, const std::size_t bufferSize) : path(path), descriptor(-1), directIO(directIO), blockSize(blockSize), bufferSize(bufferSize), freeBuffers(nrBuffers + 1), readBuffers(nrBuffers + 1), readyBuffers(nrBuffers + 1), stopping(false), nrWaiting(0), errorSet(false), started(false), finished(false) {
+  if ( blockSize == 0 || nrBuffers == 0 ) {
+    throw StreamError("ERROR: block size and number of buffers must be larger than zero");
+  }
+  if ( directIO && (blockSize % pageSize) != 0 ) {
+    throw StreamError("ERROR: with direct I/O the block size must be a multiple of " + std::to_string(pageSize));
+  }
+  if ( this->bufferSize < blockSize ) {
+    this->bufferSize = blockSize;
+  }
+  if ( directIO ) {
+    descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+    if ( descriptor < 0 && errno == EINVAL ) {
+      this->directIO = false;
+    }
+  }
+  if ( !this->directIO ) {
+    descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if ( descriptor >= 0 ) {
+      posix_fadvise(descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+  }
+  if ( descriptor < 0 ) {
+    throw StreamError("ERROR: impossible to open \"" + path + "\": " + std::strerror(errno));
+  }
+  buffers.resize(nrBuffers, nullptr);
+  blocks.resize(nrBuffers);
+  for ( unsigned int buffer = 0; buffer < nrBuffers; buffer++ ) {
+    void * memory = nullptr;
+
+    if ( posix_memalign(&memory, pageSize, pad(this->bufferSize, pageSize)) != 0 ) {
+      for ( auto allocated : buffers ) {
+        std::free(allocated);
+      }
+      close(descriptor);
+      throw StreamError("ERROR: impossible to allocate the stream buffers");
+    }
+    buffers.at(buffer) = static_cast<unsigned char *>(memory);
+    freeBuffers.tryPush(buffer);
+  }
+}
+
+StreamReader::~StreamReader() {
+  stopThreads();
+  for ( auto buffer : buffers ) {
+    std::free(buffer);
+  }
+}
+
+void StreamReader::setConversion(const StreamConversion & conversion) {
+  if ( started ) {
+    throw StreamError("ERROR: the conversion stage must be set before starting the stream");
+  }
+  this->conversion = conversion;
+}
+
+void StreamReader::start() {
+  if ( started ) {
+    return;
+  }
+  started = true;
+  reader = std::thread(&StreamReader::read, this);
+  if ( conversion ) {
+    converter = std::thread(&StreamReader::convert, this);
+  }
+}
+
+bool StreamReader::next(StreamBlock & block) {
+  unsigned int buffer = endOfStream;
+
+  if ( !started ) {
+    throw StreamError("ERROR: the stream has not been started");
+  }
+  if ( finished ) {
+    return false;
+  }
+  waitTimer.start();
+  pop(readyBuffers, buffer);
+  waitTimer.stop();
+  if ( buffer == endOfStream ) {
+    finished = true;
+    stopThreads();
+    if ( error ) {
+      std::rethrow_exception(error);
+    }
+    return false;
+  }
+  block = blocks.at(buffer);
+
+  return true;
+}
+
+void StreamReader::release(const StreamBlock & block) {
+  freeBuffers.tryPush(block.buffer);
+  wakeUp();
+}
+
+void StreamReader::read() {
+  SPSCQueue<unsigned int> & output = conversion ? readBuffers : readyBuffers;
+  std::uint64_t offset = 0;
+  std::uint64_t index = 0;
+  unsigned int buffer = 0;
+
+  try {
+    while ( pop(freeBuffers, buffer) ) {
+      std::size_t filled = 0;
+
+      readTimer.start();
+      while ( filled < blockSize ) {
+        ssize_t bytes = pread(descriptor, buffers.at(buffer) + filled, blockSize - filled, offset + filled);
+
+        if ( bytes < 0 ) {
+          if ( errno == EINTR ) {
+            continue;
+          }
+          throw StreamError("ERROR: impossible to read \"" + path + "\": " + std::strerror(errno));
+        } else if ( bytes == 0 ) {
+          break;
+        }
+        filled += bytes;
+        // Direct I/O can only continue from an aligned offset, a short read means the end of the file
+        if ( directIO && (filled % pageSize) != 0 ) {
+          break;
+        }
+      }
+      readTimer.stop();
+      if ( filled == 0 ) {
+        break;
+      }
+      blocks.at(buffer).data = buffers.at(buffer);
+      blocks.at(buffer).size = filled;
+      blocks.at(buffer).offset = offset;
+      blocks.at(buffer).index = index;
+      blocks.at(buffer).buffer = buffer;
+      offset += filled;
+      index++;
+      if ( !push(output, buffer) || filled < blockSize ) {
+        break;
+      }
+    }
+  } catch ( ... ) {
+    finish(std::current_exception(), output);
+    return;
+  }
+  push(output, endOfStream);
+}
+
+void StreamReader::convert() {
+  unsigned int buffer = 0;
+
+  try {
+    while ( pop(readBuffers, buffer) && buffer != endOfStream ) {
+      conversionTimer.start();
+      blocks.at(buffer).size = conversion(blocks.at(buffer).data, blocks.at(buffer).size, bufferSize);
+      conversionTimer.stop();
+      if ( !push(readyBuffers, buffer) ) {
+        return;
+      }
+    }
+  } catch ( ... ) {
+    finish(std::current_exception(), readyBuffers);
+    return;
+  }
+  push(readyBuffers, endOfStream);
+}
+
+void StreamReader::finish(std::exception_ptr error, SPSCQueue<unsigned int> & output) {
+  // Only the first error is kept; the end of stream marker publishes it to the consumer
+  bool expected = false;
+
+  if ( errorSet.compare_exchange_strong(expected, true) ) {
+    this->error = error;
+  }
+  push(output, endOfStream);
+}
+
+void StreamReader::stopThreads() {
+  stopping = true;
+  {
+    std::lock_guard<std::mutex> guard(waitMutex);
+  }
+  progress.notify_all();
+  if ( reader.joinable() ) {
+    reader.join();
+  }
+  if ( converter.joinable() ) {
+    converter.join();
+  }
+  if ( descriptor >= 0 ) {
+    close(descriptor);
+    descriptor = -1;
+  }
+}
+
+bool StreamReader::push(SPSCQueue<unsigned int> & queue, const unsigned int item) {
+  for ( unsigned int spin = 0; !queue.tryPush(item); spin++ ) {
+    if ( stopping.load(std::memory_order_relaxed) ) {
+      return false;
+    }
+    if ( spin < nrSpins ) {
+      std::this_thread::yield();
+      continue;
+    }
+    // A stage waiting for I/O can take milliseconds, sleep instead of occupying a core
+    std::unique_lock<std::mutex> guard(waitMutex);
+
+    nrWaiting.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    progress.wait(guard, [&]() {
+      return stopping.load(std::memory_order_relaxed) || queue.tryPush(item);
+    });
+    nrWaiting.fetch_sub(1);
+    if ( stopping.load(std::memory_order_relaxed) ) {
+      return false;
+    }
+    break;
+  }
+  wakeUp();
+
+  return true;
+}
+
+bool StreamReader::pop(SPSCQueue<unsigned int> & queue, unsigned int & item) {
+  for ( unsigned int spin = 0; !queue.tryPop(item); spin++ ) {
+    if ( stopping.load(std::memory_order_relaxed) ) {
+      return false;
+    }
+    if ( spin < nrSpins ) {
+      std::this_thread::yield();
+      continue;
+    }
+    std::unique_lock<std::mutex> guard(waitMutex);
+    bool popped = false;
+
+    nrWaiting.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    progress.wait(guard, [&]() {
+      popped = popped || queue.tryPop(item);
+      return popped || stopping.load(std::memory_order_relaxed);
+    });
+    nrWaiting.fetch_sub(1);
+    if ( !popped ) {
+      return false;
+    }
+    break;
+  }
+  wakeUp();
+
+  return true;
+}
+
+void StreamReader::wakeUp() {
+  // Pairs with the fence of the waiting stage: either the waiter sees the queue operation, or this sees the waiter
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if ( nrWaiting.load(std::memory_order_relaxed) > 0 ) {
+    {
+      std::lock_guard<std::mutex> guard(waitMutex);
+    }
+    progress.notify_all();
+  }
+}
+
+} // utils
+} // isa
@@ -0,0 +1,339 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <TaskPool.hpp>
+#include <chrono>
+#include <new>
+#include <cstdlib>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+// The pool and worker index of the calling thread, to detect nested parallel loops
+thread_local const TaskPool * currentPool = nullptr;
+thread_local unsigned int currentWorker = 0;
+
+// Number of times a worker yields, waiting for the next loop, before going to sleep
+const unsigned int nrSpins = 1024;
+// With automatic grain size, every worker executes on average this many chunks
+const std::size_t chunksPerWorker = 64;
+
+inline std::uint64_t xorshift(std::uint64_t & state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+#if defined(__linux__)
+bool pinThread(std::thread & thread, const unsigned int index) {
+  cpu_set_t available;
+  cpu_set_t selected;
+  unsigned int nrAvailable = 0;
+
+  if ( sched_getaffinity(0, sizeof(available), &available) != 0 ) {
+    return false;
+  }
+  for ( int cpu = 0; cpu < CPU_SETSIZE; cpu++ ) {
+    nrAvailable += CPU_ISSET(cpu, &available) ? 1 : 0;
+  }
+  if ( nrAvailable == 0 ) {
+    return false;
+  }
+  // The index-th available CPU, wrapping around if there are more workers than CPUs
+  unsigned int target = index % nrAvailable;
+
+  CPU_ZERO(&selected);
+  for ( int cpu = 0; cpu < CPU_SETSIZE; cpu++ ) {
+    if ( CPU_ISSET(cpu, &available) ) {
+      if ( target == 0 ) {
+        CPU_SET(cpu, &selected);
+        break;
+      }
+      target--;
+    }
+  }
+  return pthread_setaffinity_np(thread.native_handle(), sizeof(selected), &selected) == 0;
+}
+#else
+bool pinThread(std::thread &, const unsigned int) {
+  return false;
+}
+#endif
+
+} // (anonymous)
+
+WorkStealingDeque::WorkStealingDeque() : top(0), bottom(0) {
+  for ( auto & slot : slots ) {
+    slot.begin.store(0, std::memory_order_relaxed);
+    slot.end.store(0, std::memory_order_relaxed);
+  }
+}
+
+void * TaskPool::Worker::operator new(const std::size_t size) {
+  void * pointer = nullptr;
+
+  if ( posix_memalign(&pointer, alignof(Worker), size) != 0 ) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void TaskPool::Worker::operator delete(void * pointer) {
+  std::free(pointer);
+}
+
+TaskPool::TaskPool(unsigned int nrWorkers, const bool pinWorkers) : nrPinnedWorkers(0), generation(0), stopping(false), body(nullptr), grainSize(1), nrRemaining(0), nrFinished(0), cancelled(false) {
+  if ( nrWorkers == 0 ) {
+    nrWorkers = std::thread::hardware_concurrency();
+  }
+  if ( nrWorkers == 0 ) {
+    nrWorkers = 1;
+  }
+  for ( unsigned int worker = 0; worker < nrWorkers; worker++ ) {
+    workers.emplace_back(new Worker());
+    workers.back()->random = 0x9e3779b97f4a7c15ULL * (worker + 1);
+  }
+  // Worker 0 is the thread calling parallelFor()
+  for ( unsigned int worker = 1; worker < nrWorkers; worker++ ) {
+    workers.at(worker)->thread = std::thread(&TaskPool::run, this, worker);
+    if ( pinWorkers && pinThread(workers.at(worker)->thread, worker) ) {
+      nrPinnedWorkers++;
+    }
+  }
+}
+
+TaskPool::~TaskPool() {
+  {
+    std::lock_guard<std::mutex> guard(sleepMutex);
+
+    stopping = true;
+  }
+  wakeUp.notify_all();
+  for ( unsigned int worker = 1; worker < workers.size(); worker++ ) {
+    workers.at(worker)->thread.join();
+  }
+}
+
+void TaskPool::parallelFor(const std::size_t begin, const std::size_t end, const std::function<void(std::size_t, std::size_t, unsigned int)> & body, const std::size_t grainSize) {
+  if ( begin >= end ) {
+    return;
+  }
+  if ( currentPool == this ) {
+    body(begin, end, currentWorker);
+    return;
+  }
+  std::lock_guard<std::mutex> loop(loopMutex);
+  const std::size_t nrIterations = end - begin;
+  const std::size_t nrWorkers = workers.size();
+
+  this->body = &body;
+  this->grainSize = (grainSize > 0) ? grainSize : (nrIterations / (nrWorkers * chunksPerWorker));
+  if ( this->grainSize == 0 ) {
+    this->grainSize = 1;
+  }
+  cancelled.store(false, std::memory_order_relaxed);
+  error = nullptr;
+  nrRemaining.store(nrIterations, std::memory_order_relaxed);
+  nrFinished.store(0, std::memory_order_relaxed);
+  // All workers are outside of the previous loop, so the deques can be seeded from here; one contiguous block per worker
+  for ( std::size_t worker = 0; worker < nrWorkers; worker++ ) {
+    std::size_t first = begin + ((nrIterations * worker) / nrWorkers);
+    std::size_t last = begin + ((nrIterations * (worker + 1)) / nrWorkers);
+
+    if ( first < last ) {
+      workers.at(worker)->deque.push(first, last);
+    }
+  }
+  {
+    std::lock_guard<std::mutex> guard(sleepMutex);
+
+    generation.fetch_add(1, std::memory_order_release);
+  }
+  wakeUp.notify_all();
+  // The caller could be a worker of another pool
+  const TaskPool * previousPool = currentPool;
+  const unsigned int previousWorker = currentWorker;
+
+  currentPool = this;
+  currentWorker = 0;
+  work(0);
+  currentPool = previousPool;
+  currentWorker = previousWorker;
+  // The loop is complete only when every worker left it, so that no worker touches the deques or the body after returning
+  while ( nrFinished.load(std::memory_order_acquire) < nrWorkers - 1 ) {
+    std::this_thread::yield();
+  }
+  this->body = nullptr;
+  if ( error ) {
+    std::rethrow_exception(error);
+  }
+}
+
+void TaskPool::parallelFor(const std::size_t begin, const std::size_t end, const std::function<void(std::size_t, std::size_t)> & body, const std::size_t grainSize) {
+  parallelFor(begin, end, [&body](const std::size_t first, const std::size_t last, unsigned int) {
+    body(first, last);
+  }, grainSize);
+}
+
+WorkerStatistics TaskPool::getTotalStatistics() const {
+  WorkerStatistics total;
+
+  for ( const auto & worker : workers ) {
+    total.nrTasks += worker->statistics.nrTasks;
+    total.nrIterations += worker->statistics.nrIterations;
+    total.nrSteals += worker->statistics.nrSteals;
+    total.busyTime += worker->statistics.busyTime;
+    total.idleTime += worker->statistics.idleTime;
+  }
+  return total;
+}
+
+double TaskPool::getImbalance() const {
+  double maximum = 0.0;
+  double total = 0.0;
+
+  for ( const auto & worker : workers ) {
+    total += worker->statistics.busyTime;
+    if ( worker->statistics.busyTime > maximum ) {
+      maximum = worker->statistics.busyTime;
+    }
+  }
+  if ( total <= 0.0 ) {
+    return 1.0;
+  }
+  return maximum / (total / workers.size());
+}
+
+void TaskPool::resetStatistics() {
+  for ( auto & worker : workers ) {
+    worker->statistics = WorkerStatistics();
+    worker->timer.reset();
+  }
+}
+
+void TaskPool::run(const unsigned int worker) {
+  std::uint64_t seen = 0;
+
+  currentPool = this;
+  currentWorker = worker;
+  while ( true ) {
+    // Spin for a while before sleeping, so that back to back loops do not pay for a wake up
+    for ( unsigned int spin = 0; spin < nrSpins && generation.load(std::memory_order_acquire) == seen; spin++ ) {
+      std::this_thread::yield();
+    }
+    {
+      std::unique_lock<std::mutex> guard(sleepMutex);
+
+      wakeUp.wait(guard, [this, seen]() {
+        return stopping || generation.load(std::memory_order_acquire) != seen;
+      });
+      if ( stopping ) {
+        return;
+      }
+      seen = generation.load(std::memory_order_acquire);
+    }
+    work(worker);
+    nrFinished.fetch_add(1, std::memory_order_release);
+  }
+}
+
+void TaskPool::work(const unsigned int worker) {
+  Worker & self = *workers.at(worker);
+  const double busyBefore = self.timer.getTotalTime();
+  auto joined = std::chrono::steady_clock::now();
+  std::size_t begin = 0;
+  std::size_t end = 0;
+
+  while ( nrRemaining.load(std::memory_order_acquire) > 0 ) {
+    if ( self.deque.pop(begin, end) ) {
+      execute(worker, begin, end);
+    } else if ( steal(worker, begin, end) ) {
+      self.statistics.nrSteals++;
+      execute(worker, begin, end);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  double inside = std::chrono::duration<double>(std::chrono::steady_clock::now() - joined).count();
+  double busy = self.timer.getTotalTime() - busyBefore;
+
+  self.statistics.busyTime += busy;
+  self.statistics.idleTime += (inside > busy) ? (inside - busy) : 0.0;
+}
+
+void TaskPool::execute(const unsigned int worker, std::size_t begin, std::size_t end) {
+  Worker & self = *workers.at(worker);
+
+  while ( begin < end ) {
+    // Lazy binary splitting: half of the range is exposed to thieves only when there is nothing else to steal from this worker
+    if ( end - begin > grainSize && self.deque.empty() ) {
+      std::size_t middle = begin + ((end - begin) / 2);
+
+      if ( self.deque.push(middle, end) ) {
+        end = middle;
+        continue;
+      }
+    }
+    std::size_t last = (end - begin > grainSize) ? begin + grainSize : end;
+
+    if ( !cancelled.load(std::memory_order_relaxed) ) {
+      self.timer.start();
+      try {
+        (*body)(begin, last, worker);
+      } catch ( ... ) {
+        std::lock_guard<std::mutex> guard(errorMutex);
+
+        if ( !error ) {
+          error = std::current_exception();
+        }
+        cancelled.store(true, std::memory_order_relaxed);
+      }
+      self.timer.stop();
+      self.statistics.nrTasks++;
+      self.statistics.nrIterations += last - begin;
+    }
+    // Skipped chunks are still accounted, so that the loop terminates after an exception
+    nrRemaining.fetch_sub(last - begin, std::memory_order_acq_rel);
+    begin = last;
+  }
+}
+
+bool TaskPool::steal(const unsigned int worker, std::size_t & begin, std::size_t & end) {
+  const std::size_t nrWorkers = workers.size();
+
+  if ( nrWorkers < 2 ) {
+    return false;
+  }
+  // Random victims, starting from a different worker every time to spread the contention
+  std::size_t first = xorshift(workers.at(worker)->random) % nrWorkers;
+
+  for ( std::size_t attempt = 0; attempt < nrWorkers; attempt++ ) {
+    std::size_t victim = (first + attempt) % nrWorkers;
+
+    if ( victim != worker && workers.at(victim)->deque.steal(begin, end) ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // utils
+} // isa
@@ -0,0 +1,149 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Throughput.hpp>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+
+namespace isa {
+namespace utils {
+
+MachineModel::MachineModel(const double peakOperations, const double peakBandwidth) : peakOperations(peakOperations), peakBandwidth(peakBandwidth) {}
+
+double measureBandwidth(const std::size_t nrElements, const unsigned int nrIterations) {
+  std::vector<double> a(nrElements, 1.0);
+  std::vector<double> b(nrElements, 2.0);
+  std::vector<double> c(nrElements, 0.0);
+  const double scalar = 3.0;
+  Timer timer;
+  double best = 0.0;
+
+  for ( unsigned int iteration = 0; iteration < nrIterations; iteration++ ) {
+    timer.start();
+    for ( std::size_t item = 0; item < nrElements; item++ ) {
+      c[item] = a[item] + (scalar * b[item]);
+    }
+    timer.stop();
+    // Keep the compiler from discarding the kernel
+    a[iteration % nrElements] = c[(iteration * 7) % nrElements];
+    if ( iteration == 0 || timer.getLastRunTime() < best ) {
+      best = timer.getLastRunTime();
+    }
+  }
+
+  // Two loads and one store per element; write-allocate traffic is not counted, as in STREAM
+  return (3.0 * sizeof(double) * nrElements) / best;
+}
+
+double measurePeakOperations(const std::uint64_t nrIterations) {
+  // Eight independent chains hide the latency of the floating point units
+  volatile double seed = 1.0;
+  double x0 = seed, x1 = seed + 1, x2 = seed + 2, x3 = seed + 3, x4 = seed + 4, x5 = seed + 5, x6 = seed + 6, x7 = seed + 7;
+  const double multiplier = 0.999999;
+  const double addend = 0.000001;
+  Timer timer;
+
+  timer.start();
+  for ( std::uint64_t iteration = 0; iteration < nrIterations; iteration++ ) {
+    x0 = (x0 * multiplier) + addend;
+    x1 = (x1 * multiplier) + addend;
+    x2 = (x2 * multiplier) + addend;
+    x3 = (x3 * multiplier) + addend;
+    x4 = (x4 * multiplier) + addend;
+    x5 = (x5 * multiplier) + addend;
+    x6 = (x6 * multiplier) + addend;
+    x7 = (x7 * multiplier) + addend;
+  }
+  timer.stop();
+  seed = x0 + x1 + x2 + x3 + x4 + x5 + x6 + x7;
+
+  return (16.0 * nrIterations) / timer.getLastRunTime();
+}
+
+MachineModel measureMachineModel() {
+  return MachineModel(measurePeakOperations(), measureBandwidth());
+}
+
+Throughput::Throughput(const std::uint64_t operations, const std::uint64_t bytes) : operations(operations), bytes(bytes), totalOperations(0), totalBytes(0) {}
+
+void Throughput::addRun(double seconds, const std::uint64_t operations, const std::uint64_t bytes) {
+  // Intervals shorter than the clock resolution are counted as one tick, so that every run is accounted for
+  const double resolution = static_cast<double>(std::chrono::high_resolution_clock::period::num) / std::chrono::high_resolution_clock::period::den;
+
+  if ( !(seconds >= resolution) ) {
+    seconds = resolution;
+  }
+  operationsPerSecond.addElement(operations / seconds);
+  bytesPerSecond.addElement(bytes / seconds);
+  totalOperations += operations;
+  totalBytes += bytes;
+}
+
+void Throughput::reset() {
+  timer.reset();
+  operationsPerSecond.reset();
+  bytesPerSecond.reset();
+  totalOperations = 0;
+  totalBytes = 0;
+}
+
+double Throughput::getRooflinePercentage(const MachineModel & machine) const {
+  double attainable = machine.getPeakOperations();
+
+  if ( totalBytes > 0 ) {
+    attainable = machine.getAttainableOperations(getArithmeticIntensity());
+  }
+  if ( attainable <= 0.0 ) {
+    return 0.0;
+  }
+
+  return (100.0 * getOperationsPerSecond()) / attainable;
+}
+
+std::string Throughput::getReport(const std::string & unit, const bool binaryPrefixes) const {
+  std::stringstream report;
+
+  report << formatSI(getOperationsPerSecond(), unit + "/s") << " +/- " << formatSI(getOperationsPerSecondStandardDeviation(), unit + "/s");
+  if ( binaryPrefixes ) {
+    report << ", " << formatIEC(getBytesPerSecond(), "B/s") << " +/- " << formatIEC(getBytesPerSecondStandardDeviation(), "B/s");
+  } else {
+    report << ", " << formatSI(getBytesPerSecond(), "B/s") << " +/- " << formatSI(getBytesPerSecondStandardDeviation(), "B/s");
+  }
+  report << std::fixed << std::setprecision(2) << ", " << getArithmeticIntensity() << " " << unit << "/B";
+
+  return report.str();
+}
+
+std::string Throughput::getReport(const MachineModel & machine, const std::string & unit, const bool binaryPrefixes) const {
+  std::stringstream report;
+
+  report << getReport(unit, binaryPrefixes);
+  report << std::fixed << std::setprecision(1) << ", " << getRooflinePercentage(machine) << "% of roofline";
+  if ( isMemoryBound(machine) ) {
+    report << " (memory bound";
+  } else {
+    report << " (compute bound";
+  }
+  // Usually a vectorized or multi-threaded kernel compared with the single core, scalar, model
+  if ( isAboveRoofline(machine) ) {
+    report << ", above the machine model";
+  }
+  report << ")";
+
+  return report.str();
+}
+
+} // utils
+} // isa
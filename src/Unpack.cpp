@@ -0,0 +1,395 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Unpack.hpp>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ISA_UTILS_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace isa {
+namespace utils {
+
+namespace {
+
+// Values of the samples contained in every byte, for unsigned and signed samples
+template<unsigned int Bits> struct ByteTable {
+  static constexpr unsigned int nrSamples = 8 / Bits;
+  std::int16_t values[2][256][nrSamples];
+
+  ByteTable() {
+    for ( unsigned int byte = 0; byte < 256; byte++ ) {
+      for ( unsigned int sample = 0; sample < nrSamples; sample++ ) {
+        int field = static_cast<int>((byte >> (sample * Bits)) & ((1u << Bits) - 1));
+
+        values[0][byte][sample] = static_cast<std::int16_t>(field);
+        values[1][byte][sample] = static_cast<std::int16_t>((field >= (1 << (Bits - 1))) ? field - (1 << Bits) : field);
+      }
+    }
+  }
+};
+
+template<unsigned int Bits> const ByteTable<Bits> & getByteTable() {
+  static const ByteTable<Bits> table;
+
+  return table;
+}
+
+template<unsigned int Bits, typename Out> void unpackScalar(const std::uint8_t * input, Out * output, const std::size_t firstSample, const std::size_t nrSamples, const bool isSigned, const float scale, const float offset) {
+  const ByteTable<Bits> & table = getByteTable<Bits>();
+  const unsigned int perByte = ByteTable<Bits>::nrSamples;
+
+  for ( std::size_t sample = firstSample; sample < nrSamples; sample += perByte ) {
+    const std::int16_t * values = table.values[isSigned ? 1 : 0][input[sample / perByte]];
+    const std::size_t nrValues = (nrSamples - sample < perByte) ? nrSamples - sample : perByte;
+
+    for ( std::size_t value = 0; value < nrValues; value++ ) {
+      output[sample + value] = static_cast<Out>(values[value]);
+    }
+  }
+}
+
+template<unsigned int Bits> void unpackScalar(const std::uint8_t * input, float * output, const std::size_t firstSample, const std::size_t nrSamples, const bool isSigned, const float scale, const float offset) {
+  const ByteTable<Bits> & table = getByteTable<Bits>();
+  const unsigned int perByte = ByteTable<Bits>::nrSamples;
+
+  for ( std::size_t sample = firstSample; sample < nrSamples; sample += perByte ) {
+    const std::int16_t * values = table.values[isSigned ? 1 : 0][input[sample / perByte]];
+    const std::size_t nrValues = (nrSamples - sample < perByte) ? nrSamples - sample : perByte;
+
+    for ( std::size_t value = 0; value < nrValues; value++ ) {
+      output[sample + value] = (values[value] * scale) + offset;
+    }
+  }
+}
+
+template<unsigned int Bits> void packScalar(const std::int8_t * input, std::uint8_t * output, const std::size_t firstSample, const std::size_t nrSamples) {
+  const unsigned int perByte = 8 / Bits;
+  const unsigned int mask = (1u << Bits) - 1;
+
+  for ( std::size_t sample = firstSample; sample < nrSamples; sample += perByte ) {
+    const std::size_t nrValues = (nrSamples - sample < perByte) ? nrSamples - sample : perByte;
+    unsigned int byte = 0;
+
+    for ( std::size_t value = 0; value < nrValues; value++ ) {
+      byte |= (static_cast<unsigned int>(input[sample + value]) & mask) << (value * Bits);
+    }
+    output[sample / perByte] = static_cast<std::uint8_t>(byte);
+  }
+}
+
+#ifdef ISA_UTILS_X86_DISPATCH
+// Expand 16 packed bytes into 8 / Bits registers of unsigned samples, one per byte
+template<unsigned int Bits> struct Expand;
+
+template<> struct Expand<8> {
+  __attribute__((target("ssse3"))) static inline void expand(const __m128i input, __m128i * samples) {
+    samples[0] = input;
+  }
+};
+
+template<> struct Expand<4> {
+  __attribute__((target("ssse3"))) static inline void expand(const __m128i input, __m128i * samples) {
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    __m128i low = _mm_and_si128(input, mask);
+    __m128i high = _mm_and_si128(_mm_srli_epi16(input, 4), mask);
+
+    samples[0] = _mm_unpacklo_epi8(low, high);
+    samples[1] = _mm_unpackhi_epi8(low, high);
+  }
+};
+
+template<> struct Expand<2> {
+  __attribute__((target("ssse3"))) static inline void expand(const __m128i input, __m128i * samples) {
+    // Split every byte in two, with samples 0 and 2 in the first and samples 1 and 3 in the second, then unpack the nibbles
+    const __m128i pairMask = _mm_set1_epi8(0x33);
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+    __m128i even = _mm_and_si128(input, pairMask);
+    __m128i odd = _mm_and_si128(_mm_srli_epi16(input, 2), pairMask);
+    __m128i halves[2] = {_mm_unpacklo_epi8(even, odd), _mm_unpackhi_epi8(even, odd)};
+
+    for ( unsigned int half = 0; half < 2; half++ ) {
+      __m128i low = _mm_and_si128(halves[half], nibbleMask);
+      __m128i high = _mm_and_si128(_mm_srli_epi16(halves[half], 4), nibbleMask);
+
+      samples[half * 2] = _mm_unpacklo_epi16(low, high);
+      samples[(half * 2) + 1] = _mm_unpackhi_epi16(low, high);
+    }
+  }
+};
+
+template<> struct Expand<1> {
+  __attribute__((target("ssse3"))) static inline void expand(const __m128i input, __m128i * samples) {
+    // Broadcast every byte to eight lanes, and test a different bit in each lane
+    const __m128i bits = _mm_set_epi8(-128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1);
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i pairs = _mm_set_epi8(1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    for ( unsigned int pair = 0; pair < 8; pair++ ) {
+      const __m128i control = _mm_add_epi8(pairs, _mm_set1_epi8(static_cast<char>(pair * 2)));
+      __m128i broadcast = _mm_shuffle_epi8(input, control);
+
+      samples[pair] = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(broadcast, bits), bits), one);
+    }
+  }
+};
+
+// Store 16 samples; the samples are sign extended, unless zeroExtend is set
+__attribute__((target("ssse3"))) inline void store(const __m128i samples, std::int8_t * output, const bool, const float, const float) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(output), samples);
+}
+
+__attribute__((target("ssse3"))) inline void widen(const __m128i samples, const bool zeroExtend, __m128i & low, __m128i & high) {
+  const __m128i extension = zeroExtend ? _mm_setzero_si128() : _mm_cmpgt_epi8(_mm_setzero_si128(), samples);
+
+  low = _mm_unpacklo_epi8(samples, extension);
+  high = _mm_unpackhi_epi8(samples, extension);
+}
+
+__attribute__((target("ssse3"))) inline void store(const __m128i samples, std::int16_t * output, const bool zeroExtend, const float, const float) {
+  __m128i low;
+  __m128i high;
+
+  widen(samples, zeroExtend, low, high);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(output), low);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 8), high);
+}
+
+__attribute__((target("ssse3"))) inline void store(const __m128i samples, float * output, const bool zeroExtend, const float scale, const float offset) {
+  const __m128 scaleVector = _mm_set1_ps(scale);
+  const __m128 offsetVector = _mm_set1_ps(offset);
+  __m128i halves[2];
+
+  widen(samples, zeroExtend, halves[0], halves[1]);
+  for ( unsigned int half = 0; half < 2; half++ ) {
+    // After widening all values fit in 16 bits signed integers
+    const __m128i extension = _mm_srai_epi16(halves[half], 15);
+    __m128 low = _mm_cvtepi32_ps(_mm_unpacklo_epi16(halves[half], extension));
+    __m128 high = _mm_cvtepi32_ps(_mm_unpackhi_epi16(halves[half], extension));
+
+    _mm_storeu_ps(output + (half * 8), _mm_add_ps(_mm_mul_ps(low, scaleVector), offsetVector));
+    _mm_storeu_ps(output + (half * 8) + 4, _mm_add_ps(_mm_mul_ps(high, scaleVector), offsetVector));
+  }
+}
+
+// The kernels return the number of samples processed
+template<unsigned int Bits, typename Out> __attribute__((target("ssse3"))) std::size_t unpackSSSE3(const std::uint8_t * input, Out * output, const std::size_t nrSamples, const bool isSigned, const float scale, const float offset) {
+  const std::size_t samplesPerBlock = 128 / Bits;
+  const __m128i sign = _mm_set1_epi8(static_cast<char>((Bits < 8) ? (1 << (Bits - 1)) : 0));
+  const bool zeroExtend = (Bits == 8) && !isSigned;
+  std::size_t sample = 0;
+
+  for ( ; sample + samplesPerBlock <= nrSamples; sample += samplesPerBlock ) {
+    __m128i samples[8 / Bits];
+
+    Expand<Bits>::expand(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + ((sample * Bits) / 8))), samples);
+    for ( unsigned int vector = 0; vector < 8 / Bits; vector++ ) {
+      if ( Bits < 8 && isSigned ) {
+        samples[vector] = _mm_sub_epi8(_mm_xor_si128(samples[vector], sign), sign);
+      }
+      store(samples[vector], output + sample + (vector * 16), zeroExtend, scale, offset);
+    }
+  }
+
+  return sample;
+}
+
+template<unsigned int Bits> std::size_t packSSSE3(const std::int8_t * input, std::uint8_t * output, std::size_t nrSamples);
+
+template<> __attribute__((target("ssse3"))) std::size_t packSSSE3<1>(const std::int8_t * input, std::uint8_t * output, const std::size_t nrSamples) {
+  std::size_t sample = 0;
+
+  for ( ; sample + 16 <= nrSamples; sample += 16 ) {
+    // Move bit zero of every byte to the most significant position, and collect them
+    __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + sample));
+    std::uint16_t bits = static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_slli_epi16(samples, 7)));
+
+    output[sample / 8] = static_cast<std::uint8_t>(bits & 0xff);
+    output[(sample / 8) + 1] = static_cast<std::uint8_t>(bits >> 8);
+  }
+
+  return sample;
+}
+
+template<> __attribute__((target("ssse3"))) std::size_t packSSSE3<2>(const std::int8_t * input, std::uint8_t * output, const std::size_t nrSamples) {
+  const __m128i mask = _mm_set1_epi8(0x03);
+  const __m128i pairWeights = _mm_set1_epi16(0x0401);
+  const __m128i quadWeights = _mm_set1_epi32(0x00100001);
+  std::size_t sample = 0;
+
+  for ( ; sample + 64 <= nrSamples; sample += 64 ) {
+    __m128i words[4];
+
+    for ( unsigned int vector = 0; vector < 4; vector++ ) {
+      __m128i samples = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + sample + (vector * 16))), mask);
+
+      words[vector] = _mm_madd_epi16(_mm_maddubs_epi16(samples, pairWeights), quadWeights);
+    }
+    __m128i packed = _mm_packus_epi16(_mm_packs_epi32(words[0], words[1]), _mm_packs_epi32(words[2], words[3]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + (sample / 4)), packed);
+  }
+
+  return sample;
+}
+
+template<> __attribute__((target("ssse3"))) std::size_t packSSSE3<4>(const std::int8_t * input, std::uint8_t * output, const std::size_t nrSamples) {
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  const __m128i weights = _mm_set1_epi16(0x1001);
+  std::size_t sample = 0;
+
+  for ( ; sample + 32 <= nrSamples; sample += 32 ) {
+    __m128i low = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + sample)), mask);
+    __m128i high = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + sample + 16)), mask);
+    __m128i packed = _mm_packus_epi16(_mm_maddubs_epi16(low, weights), _mm_maddubs_epi16(high, weights));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + (sample / 2)), packed);
+  }
+
+  return sample;
+}
+
+template<> std::size_t packSSSE3<8>(const std::int8_t * input, std::uint8_t * output, const std::size_t nrSamples) {
+  std::memcpy(output, input, nrSamples);
+
+  return nrSamples;
+}
+#endif // ISA_UTILS_X86_DISPATCH
+
+UnpackKernel selectKernel() {
+#ifdef ISA_UTILS_X86_DISPATCH
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("ssse3") ) {
+    return UnpackKernel::SSSE3;
+  }
+#endif
+  return UnpackKernel::Scalar;
+}
+
+template<unsigned int Bits, typename Out> void unpackSamples(const std::uint8_t * input, Out * output, const std::size_t nrSamples, const bool isSigned, const float scale, const float offset) {
+  std::size_t sample = 0;
+
+#ifdef ISA_UTILS_X86_DISPATCH
+  if ( getUnpackKernel() == UnpackKernel::SSSE3 ) {
+    sample = unpackSSSE3<Bits>(input, output, nrSamples, isSigned, scale, offset);
+  }
+#endif
+  unpackScalar<Bits>(input, output, sample, nrSamples, isSigned, scale, offset);
+}
+
+} // (anonymous)
+
+UnpackKernel getUnpackKernel() {
+  static const UnpackKernel kernel = selectKernel();
+
+  return kernel;
+}
+
+std::string toString(const UnpackKernel kernel) {
+  switch ( kernel ) {
+    case UnpackKernel::SSSE3:
+      return "SSSE3";
+    default:
+      return "scalar";
+  }
+}
+
+template<unsigned int Bits> void unpack(const std::uint8_t * input, std::int8_t * output, const std::size_t nrSamples, const bool isSigned) {
+  unpackSamples<Bits>(input, output, nrSamples, isSigned, 1.0f, 0.0f);
+}
+
+template<unsigned int Bits> void unpack(const std::uint8_t * input, std::int16_t * output, const std::size_t nrSamples, const bool isSigned) {
+  unpackSamples<Bits>(input, output, nrSamples, isSigned, 1.0f, 0.0f);
+}
+
+template<unsigned int Bits> void unpack(const std::uint8_t * input, float * output, const std::size_t nrSamples, const bool isSigned, const float scale, const float offset) {
+  unpackSamples<Bits>(input, output, nrSamples, isSigned, scale, offset);
+}
+
+template<unsigned int Bits> void unpack(const std::uint8_t * input, float * output, const std::size_t nrSamples, const UnpackTable<Bits> & table) {
+  const unsigned int perByte = 8 / Bits;
+  const std::size_t nrBytes = nrSamples / perByte;
+
+  for ( std::size_t byte = 0; byte < nrBytes; byte++ ) {
+    std::memcpy(output + (byte * perByte), table.getSamples(input[byte]), perByte * sizeof(float));
+  }
+  if ( nrSamples % perByte != 0 ) {
+    std::memcpy(output + (nrBytes * perByte), table.getSamples(input[nrBytes]), (nrSamples % perByte) * sizeof(float));
+  }
+}
+
+template<unsigned int Bits> void pack(const std::int8_t * input, std::uint8_t * output, const std::size_t nrSamples) {
+  std::size_t sample = 0;
+
+#ifdef ISA_UTILS_X86_DISPATCH
+  if ( getUnpackKernel() == UnpackKernel::SSSE3 ) {
+    sample = packSSSE3<Bits>(input, output, nrSamples);
+  }
+#endif
+  packScalar<Bits>(input, output, sample, nrSamples);
+}
+
+template<unsigned int Bits> void pack(const float * input, std::uint8_t * output, const std::size_t nrSamples, const bool isSigned, const float scale, const float offset) {
+  // Quantize in blocks small enough to stay in cache, then pack them with the integer kernels
+  const std::size_t blockSize = 1024;
+  const float minimum = isSigned ? -static_cast<float>(1 << (Bits - 1)) : 0.0f;
+  const float maximum = isSigned ? static_cast<float>((1 << (Bits - 1)) - 1) : static_cast<float>((1 << Bits) - 1);
+  std::int8_t block[blockSize];
+
+  for ( std::size_t first = 0; first < nrSamples; first += blockSize ) {
+    const std::size_t nrValues = (nrSamples - first < blockSize) ? nrSamples - first : blockSize;
+
+    for ( std::size_t value = 0; value < nrValues; value++ ) {
+      float quantized = std::nearbyint((input[first + value] - offset) / scale);
+
+      // NaN is not ordered, and converting it to an integer is undefined
+      if ( std::isnan(quantized) ) {
+        quantized = 0.0f;
+      }
+      quantized = (quantized < minimum) ? minimum : ((quantized > maximum) ? maximum : quantized);
+      block[value] = static_cast<std::int8_t>(static_cast<int>(quantized));
+    }
+    pack<Bits>(block, output + ((first * Bits) / 8), nrValues);
+  }
+}
+
+template void unpack<1>(const std::uint8_t * input, std::int8_t * output, std::size_t nrSamples, bool isSigned);
+template void unpack<2>(const std::uint8_t * input, std::int8_t * output, std::size_t nrSamples, bool isSigned);
+template void unpack<4>(const std::uint8_t * input, std::int8_t * output, std::size_t nrSamples, bool isSigned);
+template void unpack<8>(const std::uint8_t * input, std::int8_t * output, std::size_t nrSamples, bool isSigned);
+template void unpack<1>(const std::uint8_t * input, std::int16_t * output, std::size_t nrSamples, bool isSigned);
+template void unpack<2>(const std::uint8_t * input, std::int16_t * output, std::size_t nrSamples, bool isSigned);
+template void unpack<4>(const std::uint8_t * input, std::int16_t * output, std::size_t nrSamples, bool isSigned);
+template void unpack<8>(const std::uint8_t * input, std::int16_t * output, std::size_t nrSamples, bool isSigned);
+template void unpack<1>(const std::uint8_t * input, float * output, std::size_t nrSamples, bool isSigned, float scale, float offset);
+template void unpack<2>(const std::uint8_t * input, float * output, std::size_t nrSamples, bool isSigned, float scale, float offset);
+template void unpack<4>(const std::uint8_t * input, float * output, std::size_t nrSamples, bool isSigned, float scale, float offset);
+template void unpack<8>(const std::uint8_t * input, float * output, std::size_t nrSamples, bool isSigned, float scale, float offset);
+template void unpack<1>(const std::uint8_t * input, float * output, std::size_t nrSamples, const UnpackTable<1> & table);
+template void unpack<2>(const std::uint8_t * input, float * output, std::size_t nrSamples, const UnpackTable<2> & table);
+template void unpack<4>(const std::uint8_t * input, float * output, std::size_t nrSamples, const UnpackTable<4> & table);
+template void unpack<8>(const std::uint8_t * input, float * output, std::size_t nrSamples, const UnpackTable<8> & table);
+template void pack<1>(const std::int8_t * input, std::uint8_t * output, std::size_t nrSamples);
+template void pack<2>(const std::int8_t * input, std::uint8_t * output, std::size_t nrSamples);
+template void pack<4>(const std::int8_t * input, std::uint8_t * output, std::size_t nrSamples);
+template void pack<8>(const std::int8_t * input, std::uint8_t * output, std::size_t nrSamples);
+template void pack<1>(const float * input, std::uint8_t * output, std::size_t nrSamples, bool isSigned, float scale, float offset);
+template void pack<2>(const float * input, std::uint8_t * output, std::size_t nrSamples, bool isSigned, float scale, float offset);
+template void pack<4>(const float * input, std::uint8_t * output, std::size_t nrSamples, bool isSigned, float scale, float offset);
+template void pack<8>(const float * input, std::uint8_t * output, std::size_t nrSamples, bool isSigned, float scale, float offset);
+
+} // utils
+} // isa
@@ -0,0 +1,181 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Accumulator.hpp>
+#include <Statistics.hpp>
+#include <Timer.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+using isa::utils::Accumulate;
+
+TEST(AccumulatorTest, SameAsStatistics) {
+  isa::utils::Statistics<double> statistics;
+  isa::utils::Accumulator<double, Accumulate::All> accumulator;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.5, 100.0);
+
+  for ( unsigned int item = 0; item < 10000; item++ ) {
+    double sample = distribution(generator);
+
+    statistics.addElement(sample);
+    accumulator.addElement(sample);
+  }
+  EXPECT_EQ(statistics.getNrElements(), accumulator.getNrElements());
+  EXPECT_DOUBLE_EQ(statistics.getMean(), accumulator.getMean());
+  EXPECT_DOUBLE_EQ(statistics.getHarmonicMean(), accumulator.getHarmonicMean());
+  EXPECT_DOUBLE_EQ(statistics.getVariance(), accumulator.getVariance());
+  EXPECT_DOUBLE_EQ(statistics.getStandardDeviation(), accumulator.getStandardDeviation());
+  EXPECT_DOUBLE_EQ(statistics.getCoefficientOfVariation(), accumulator.getCoefficientOfVariation());
+  EXPECT_DOUBLE_EQ(statistics.getRootMeanSquare(), accumulator.getRootMeanSquare());
+  EXPECT_EQ(statistics.getMin(), accumulator.getMin());
+  EXPECT_EQ(statistics.getMax(), accumulator.getMax());
+  EXPECT_NEAR(statistics.getMean() * statistics.getNrElements(), accumulator.getSum(), 1.0e-06);
+  accumulator.reset();
+  accumulator.addElement(2.0);
+  EXPECT_EQ(1, accumulator.getNrElements());
+  EXPECT_DOUBLE_EQ(2.0, accumulator.getMean());
+  EXPECT_DOUBLE_EQ(0.0, accumulator.getVariance());
+  EXPECT_DOUBLE_EQ(2.0, accumulator.getMin());
+  EXPECT_DOUBLE_EQ(2.0, accumulator.getMax());
+}
+
+TEST(AccumulatorTest, SelectedFeatures) {
+  isa::utils::Accumulator<float, Accumulate::Mean | Accumulate::MinMax> accumulator;
+  isa::utils::Accumulator<int, Accumulate::MinMax> range;
+
+  for ( int item = -5; item <= 5; item++ ) {
+    accumulator.addElement(static_cast<float>(item));
+    range.addElement(item * 3);
+  }
+  // Mean implies Count
+  EXPECT_EQ(11, accumulator.getNrElements());
+  EXPECT_NEAR(0.0, accumulator.getMean(), 1.0e-06);
+  EXPECT_EQ(-5.0f, accumulator.getMin());
+  EXPECT_EQ(5.0f, accumulator.getMax());
+  EXPECT_EQ(-15, range.getMin());
+  EXPECT_EQ(15, range.getMax());
+  // Samples that are all negative, or all the same
+  isa::utils::Accumulator<double, Accumulate::MinMax> negative;
+  negative.addElement(-3.0);
+  negative.addElement(-1.0);
+  EXPECT_EQ(-3.0, negative.getMin());
+  EXPECT_EQ(-1.0, negative.getMax());
+  EXPECT_TRUE(isa::utils::has(Accumulate::Variance, Accumulate::Mean));
+  EXPECT_TRUE(isa::utils::has(Accumulate::Variance, Accumulate::Count));
+  EXPECT_TRUE(isa::utils::has(Accumulate::RootMeanSquare, Accumulate::Count));
+  EXPECT_FALSE(isa::utils::has(Accumulate::MinMax | Accumulate::Sum, Accumulate::Count));
+  EXPECT_FALSE(isa::utils::has(Accumulate::All, Accumulate::Exact));
+}
+
+TEST(AccumulatorTest, ObjectSize) {
+  // Disabled features take no space
+  EXPECT_EQ(2 * sizeof(double), sizeof(isa::utils::Accumulator<double, Accumulate::MinMax>));
+  EXPECT_EQ(sizeof(std::uint64_t), sizeof(isa::utils::Accumulator<float, Accumulate::Count>));
+  EXPECT_EQ(sizeof(std::uint64_t) + sizeof(double), sizeof(isa::utils::Accumulator<double, Accumulate::Mean>));
+  EXPECT_EQ(sizeof(std::uint64_t) + (4 * sizeof(double)), sizeof(isa::utils::Accumulator<double, Accumulate::Variance | Accumulate::MinMax>));
+  EXPECT_LE(sizeof(isa::utils::Accumulator<double, Accumulate::All>), sizeof(isa::utils::Statistics<double>) + sizeof(double));
+}
+
+TEST(AccumulatorTest, Exact) {
+  isa::utils::Accumulator<std::int32_t, Accumulate::Sum | Accumulate::Variance | Accumulate::RootMeanSquare | Accumulate::Exact> accumulator;
+  isa::utils::Accumulator<std::int64_t, Accumulate::Mean | Accumulate::Sum | Accumulate::Exact> wide;
+  const std::int64_t large = 4000000000000000000LL;
+
+  // Values that lose precision in a double sum
+  for ( unsigned int item = 0; item < 1000; item++ ) {
+    accumulator.addElement(2147483647);
+    accumulator.addElement(-2147483647 + 1);
+    wide.addElement(large);
+    wide.addElement(1);
+  }
+  EXPECT_EQ(2000, accumulator.getNrElements());
+  EXPECT_TRUE(accumulator.getExactSum() == 1000);
+  EXPECT_DOUBLE_EQ(0.5, accumulator.getMean());
+  // Deviations are +-2147483646.5, for 2000 samples
+  EXPECT_NEAR((2147483646.5 * 2147483646.5 * 2000.0) / 1999.0, accumulator.getVariance(), 1.0e+04);
+  EXPECT_NEAR(2147483646.5, accumulator.getRootMeanSquare(), 1.0);
+  EXPECT_TRUE(wide.getExactSum() == (static_cast<__int128>(large) + 1) * 1000);
+  EXPECT_DOUBLE_EQ((static_cast<double>(large) + 1.0) / 2.0, wide.getMean());
+  // Unsigned samples, whose squares do not fit in a signed 64 bits integer
+  isa::utils::Accumulator<std::uint32_t, Accumulate::RootMeanSquare | Accumulate::MinMax | Accumulate::Exact> unsignedAccumulator;
+  unsignedAccumulator.addElement(4294967295u);
+  unsignedAccumulator.addElement(4294967295u);
+  EXPECT_DOUBLE_EQ(4294967295.0, unsignedAccumulator.getRootMeanSquare());
+  EXPECT_EQ(4294967295u, unsignedAccumulator.getMax());
+  EXPECT_EQ(4294967295u, unsignedAccumulator.getMin());
+  accumulator.reset();
+  EXPECT_EQ(0, accumulator.getNrElements());
+  EXPECT_DOUBLE_EQ(0.0, accumulator.getMean());
+  EXPECT_DOUBLE_EQ(0.0, accumulator.getVariance());
+}
+
+TEST(AccumulatorTest, ExactLargeMean) {
+  // Means much larger than the spread, where subtracting sum^2 / n in floating point cancels all digits
+  isa::utils::Accumulator<std::int32_t, Accumulate::Variance | Accumulate::Exact> twoValues;
+  isa::utils::Accumulator<std::int32_t, Accumulate::Variance | Accumulate::Exact> threeValues;
+  isa::utils::Accumulator<std::int32_t, Accumulate::Variance | Accumulate::Exact> negative;
+  isa::utils::Accumulator<std::uint32_t, Accumulate::Variance | Accumulate::Exact> unsignedValues;
+  const double nrTwo = 2000000.0;
+  const double nrThree = 1500000.0;
+
+  for ( unsigned int item = 0; item < 2000000; item++ ) {
+    twoValues.addElement(2000000000 + static_cast<std::int32_t>(item % 2));
+  }
+  for ( unsigned int item = 0; item < 1500000; item++ ) {
+    threeValues.addElement(2000000000 + static_cast<std::int32_t>(item % 3));
+    negative.addElement(-2000000000 - static_cast<std::int32_t>(item % 3));
+    unsignedValues.addElement(4000000000u + (item % 3));
+  }
+  EXPECT_NEAR(0.25 * nrTwo / (nrTwo - 1.0), twoValues.getVariance(), 1.0e-12);
+  EXPECT_DOUBLE_EQ(2000000000.5, twoValues.getMean());
+  EXPECT_NEAR((2.0 / 3.0) * nrThree / (nrThree - 1.0), threeValues.getVariance(), 1.0e-12);
+  EXPECT_NEAR((2.0 / 3.0) * nrThree / (nrThree - 1.0), negative.getVariance(), 1.0e-12);
+  EXPECT_NEAR((2.0 / 3.0) * nrThree / (nrThree - 1.0), unsignedValues.getVariance(), 1.0e-12);
+  EXPECT_DOUBLE_EQ(2000000001.0, threeValues.getMean());
+  EXPECT_DOUBLE_EQ(-2000000001.0, negative.getMean());
+  EXPECT_DOUBLE_EQ(4000000001.0, unsignedValues.getMean());
+  // Zero variance
+  isa::utils::Accumulator<std::int32_t, Accumulate::Variance | Accumulate::Exact> constant;
+  for ( unsigned int item = 0; item < 1000; item++ ) {
+    constant.addElement(-2147483647);
+  }
+  EXPECT_EQ(0.0, constant.getVariance());
+}
+
+TEST(AccumulatorTest, Timer) {
+  isa::utils::Timer timer;
+
+  // Values of a timer without intervals
+  EXPECT_EQ(std::numeric_limits<double>::min(), timer.getMaxTime());
+  EXPECT_EQ(std::numeric_limits<double>::max(), timer.getMinTime());
+  EXPECT_EQ(0.0, timer.getAverageTime());
+  EXPECT_EQ(0.0, timer.getStandardDeviation());
+
+  for ( unsigned int run = 0; run < 5; run++ ) {
+    timer.start();
+    timer.stop();
+  }
+  EXPECT_EQ(5, timer.getNrRuns());
+  EXPECT_GE(timer.getMaxTime(), timer.getMinTime());
+  EXPECT_GE(timer.getAverageTime(), timer.getMinTime());
+  EXPECT_LE(timer.getAverageTime(), timer.getMaxTime());
+  EXPECT_NEAR(timer.getTotalTime(), timer.getAverageTime() * 5, 1.0e-09);
+  EXPECT_GE(timer.getStandardDeviation(), 0.0);
+  timer.reset();
+  EXPECT_EQ(0, timer.getNrRuns());
+  EXPECT_EQ(std::numeric_limits<double>::min(), timer.getMaxTime());
+}
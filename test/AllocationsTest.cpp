@@ -0,0 +1,74 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Allocations.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(AllocationsTest, HooksInstalled) {
+  EXPECT_TRUE(isa::utils::allocationHooksInstalled());
+}
+
+TEST(AllocationsTest, CountAllocations) {
+  isa::utils::AllocationCounters counters;
+
+  {
+    isa::utils::AllocationScope scope;
+    // Calling the operators directly, because new and delete expressions can be elided by the optimizer
+    void * large = ::operator new(1048576);
+
+    ::operator delete(large);
+    {
+      std::vector<int> small(16);
+    }
+    counters = scope.getCounters();
+  }
+  EXPECT_EQ(2, counters.nrAllocations);
+  EXPECT_EQ(2, counters.nrDeallocations);
+  EXPECT_EQ(1048576 + (16 * sizeof(int)), counters.allocatedBytes);
+  EXPECT_EQ(counters.allocatedBytes, counters.freedBytes);
+  EXPECT_EQ(0, counters.liveBytes);
+  EXPECT_EQ(1048576, counters.peakLiveBytes);
+}
+
+TEST(AllocationsTest, SteadyStateBudget) {
+  isa::utils::AllocationProfiler profiler;
+  std::vector<float> buffer;
+
+  buffer.reserve(1024);
+  for ( unsigned int iteration = 0; iteration < 10; iteration++ ) {
+    profiler.start();
+    buffer.clear();
+    for ( unsigned int item = 0; item < 1024; item++ ) {
+      buffer.push_back(static_cast<float>(item * iteration));
+    }
+    profiler.stop();
+  }
+  EXPECT_EQ(10, profiler.getTimer().getNrRuns());
+  EXPECT_EQ(0, profiler.getTotalAllocations());
+  EXPECT_EQ(0, profiler.getPeakLiveBytes());
+  profiler.start();
+  buffer.shrink_to_fit();
+  buffer.push_back(1.0f);
+  profiler.stop();
+  EXPECT_LE(1, profiler.getLastRun().nrAllocations);
+  EXPECT_LE(sizeof(float), profiler.getTotalAllocatedBytes());
+}
+
+TEST(AllocationsTest, MemoryUsage) {
+  isa::utils::MemoryUsage usage = isa::utils::getMemoryUsage();
+
+  EXPECT_LT(0, usage.residentBytes);
+  EXPECT_LE(usage.residentBytes, usage.peakResidentBytes);
+}
@@ -0,0 +1,142 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Arena.hpp>
+#include <Allocations.hpp>
+#include <utils.hpp>
+#include <gtest/gtest.h>
+#include <list>
+#include <string>
+#include <vector>
+#include <limits>
+#include <new>
+#include <cstdint>
+
+using ArenaString = std::basic_string<char, std::char_traits<char>, isa::utils::ArenaAllocator<char>>;
+
+TEST(ArenaTest, Alignment) {
+  isa::utils::Arena arena(1024, 64);
+
+  for ( unsigned int allocation = 0; allocation < 64; allocation++ ) {
+    void * pointer = arena.allocate(allocation + 1);
+
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(pointer) % 64);
+  }
+  void * pointer = arena.allocate(8, 256);
+  EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(pointer) % 256);
+  // Sizes that overflow the end of the chunk
+  const std::size_t maximum = std::numeric_limits<std::size_t>::max();
+  EXPECT_THROW(arena.allocate(maximum - 8), std::bad_alloc);
+  EXPECT_THROW(isa::utils::ArenaAllocator<double>(arena).allocate((maximum / sizeof(double)) + 2), std::bad_alloc);
+}
+
+TEST(ArenaTest, ResetReusesChunks) {
+  isa::utils::Arena arena(4096);
+
+  for ( unsigned int iteration = 0; iteration < 8; iteration++ ) {
+    arena.reset();
+    for ( unsigned int allocation = 0; allocation < 16; allocation++ ) {
+      arena.allocate(1000);
+    }
+    arena.allocate(10000);
+  }
+  EXPECT_LE(26000, arena.getUsedBytes());
+  EXPECT_EQ(arena.getUsedBytes(), arena.getHighWaterMark());
+  EXPECT_EQ(5, arena.getNrChunkAllocations());
+  arena.release();
+  EXPECT_EQ(0, arena.getCapacity());
+  EXPECT_EQ(0, arena.getUsedBytes());
+}
+
+TEST(ArenaTest, ThreadLocal) {
+  EXPECT_EQ(&isa::utils::Arena::getThreadLocal(), &isa::utils::Arena::getThreadLocal());
+}
+
+TEST(ArenaTest, ZeroAllocationsInSteadyState) {
+  isa::utils::Arena arena;
+  isa::utils::FixedSizePool pool(64);
+  std::string output;
+  const std::string source("<%NAME%> = <%VALUE%> + <%NAME%>;");
+  const std::string item("a_variable_name_too_long_for_short_strings");
+  isa::utils::AllocationCounters counters;
+
+  ASSERT_TRUE(isa::utils::allocationHooksInstalled());
+  for ( unsigned int iteration = 0; iteration < 4; iteration++ ) {
+    if ( iteration == 2 ) {
+      counters = isa::utils::getAllocationCounters();
+    }
+    arena.reset();
+    std::vector<float, isa::utils::ArenaAllocator<float>> scratch{isa::utils::ArenaAllocator<float>(arena)};
+    ArenaString name(item.c_str(), isa::utils::ArenaAllocator<char>(arena));
+    std::list<int, isa::utils::PoolAllocator<int>> nodes{isa::utils::PoolAllocator<int>(pool)};
+
+    for ( unsigned int element = 0; element < 4096; element++ ) {
+      scratch.push_back(element);
+    }
+    for ( unsigned int element = 0; element < 128; element++ ) {
+      nodes.push_back(element);
+    }
+    isa::utils::replace(source, "<%NAME%>", item, output);
+    EXPECT_EQ(item.size(), name.size());
+    EXPECT_EQ(4096, scratch.size());
+    EXPECT_EQ(128, nodes.size());
+  }
+  EXPECT_EQ(counters.nrAllocations, isa::utils::getAllocationCounters().nrAllocations);
+}
+
+TEST(ArenaTest, ReplaceIntoString) {
+  std::string output("previous content");
+  ArenaString arenaOutput{isa::utils::ArenaAllocator<char>()};
+
+  isa::utils::replace("<%A%> + <%A%> = b", "<%A%>", "x", output);
+  EXPECT_EQ("x + x = b", output);
+  isa::utils::replace("no placeholder", "<%A%>", "x", output);
+  EXPECT_EQ("no placeholder", output);
+  isa::utils::replace("<%A%>", "<%A%>", "variable", arenaOutput);
+  EXPECT_STREQ("variable", arenaOutput.c_str());
+}
+
+TEST(FixedSizePoolTest, Recycle) {
+  isa::utils::FixedSizePool pool(24, 8, 4);
+  std::vector<void *> blocks;
+
+  EXPECT_EQ(8, pool.getAlignment());
+
+  for ( unsigned int block = 0; block < 10; block++ ) {
+    blocks.push_back(pool.allocate());
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(blocks.back()) % 8);
+  }
+  EXPECT_EQ(10, pool.getNrLiveBlocks());
+  EXPECT_EQ(3, pool.getNrChunkAllocations());
+  for ( auto block : blocks ) {
+    pool.deallocate(block);
+  }
+  EXPECT_EQ(0, pool.getNrLiveBlocks());
+  EXPECT_EQ(10, pool.getHighWaterMark());
+  for ( unsigned int block = 0; block < 10; block++ ) {
+    pool.deallocate(pool.allocate());
+  }
+  EXPECT_EQ(3, pool.getNrChunkAllocations());
+}
+
+TEST(ObjectPoolTest, CreateDestroy) {
+  isa::utils::ObjectPool<std::pair<double, int>> pool(8);
+  std::pair<double, int> * object = pool.create(3.5, 7);
+
+  EXPECT_EQ(3.5, object->first);
+  EXPECT_EQ(7, object->second);
+  EXPECT_EQ(1, pool.getPool().getNrLiveBlocks());
+  pool.destroy(object);
+  EXPECT_EQ(0, pool.getPool().getNrLiveBlocks());
+}
@@ -0,0 +1,188 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Bitmap.hpp>
+#include <gtest/gtest.h>
+#include <functional>
+#include <vector>
+
+namespace {
+
+isa::utils::Bitmap randomBitmap(const std::size_t nrBits, const unsigned int seed, std::vector<bool> & reference) {
+  isa::utils::Bitmap bitmap(nrBits);
+
+  reference.assign(nrBits, false);
+  for ( std::size_t bit = 0; bit < nrBits; bit++ ) {
+    if ( (((bit + seed) * 2654435761u) >> 7) % 3 == 0 ) {
+      bitmap.set(bit);
+      reference.at(bit) = true;
+    }
+  }
+
+  return bitmap;
+}
+
+// Run the test body with every kernel supported by the CPU, not only the fastest one
+void forEachKernel(const std::function<void()> & body) {
+  const isa::utils::BitmapKernel selected = isa::utils::getBitmapKernel();
+
+  for ( auto kernel : {isa::utils::BitmapKernel::Scalar, isa::utils::BitmapKernel::AVX2, isa::utils::BitmapKernel::AVX512} ) {
+    if ( !isa::utils::setBitmapKernel(kernel) ) {
+      EXPECT_FALSE(isa::utils::isSupported(kernel));
+      continue;
+    }
+    SCOPED_TRACE(isa::utils::toString(kernel));
+    body();
+  }
+  EXPECT_TRUE(isa::utils::setBitmapKernel(selected));
+}
+
+} // (anonymous)
+
+TEST(BitmapTest, SetClear) {
+  isa::utils::Bitmap bitmap(130);
+
+  EXPECT_EQ(130, bitmap.getNrBits());
+  EXPECT_EQ(0, bitmap.getNrWords() % 8);
+  bitmap.set(0);
+  bitmap.set(64);
+  bitmap.set(129);
+  EXPECT_TRUE(bitmap.test(0));
+  EXPECT_TRUE(bitmap.test(64));
+  EXPECT_TRUE(bitmap.test(129));
+  EXPECT_FALSE(bitmap.test(1));
+  bitmap.clear(64);
+  EXPECT_FALSE(bitmap.test(64));
+  EXPECT_EQ(2, bitmap.count());
+  EXPECT_EQ(130, isa::utils::Bitmap(130, true).count());
+  // Bits in the padding of the last word are outside of the bitmap
+  EXPECT_THROW(bitmap.test(130), isa::utils::BitmapError);
+  EXPECT_THROW(bitmap.set(191), isa::utils::BitmapError);
+  EXPECT_THROW(bitmap.clear(1000000), isa::utils::BitmapError);
+  EXPECT_EQ(2, bitmap.count());
+}
+
+TEST(BitmapTest, Ranges) {
+  for ( std::size_t first : {0, 3, 63, 64, 100} ) {
+    for ( std::size_t last : {1, 64, 65, 130, 300, 1000} ) {
+      isa::utils::Bitmap bitmap(300);
+      isa::utils::Bitmap cleared(300, true);
+
+      bitmap.setRange(first, last);
+      cleared.clearRange(first, last);
+      for ( std::size_t bit = 0; bit < 300; bit++ ) {
+        bool inside = bit >= first && bit < last;
+
+        ASSERT_EQ(inside, bitmap.test(bit)) << first << " " << last << " " << bit;
+        ASSERT_EQ(!inside, cleared.test(bit)) << first << " " << last << " " << bit;
+      }
+      EXPECT_EQ(bitmap.count() + cleared.count(), 300);
+    }
+  }
+}
+
+TEST(BitmapTest, Operations) {
+  forEachKernel([]() {
+    const std::size_t nrBits = 10007;
+    std::vector<bool> left;
+    std::vector<bool> right;
+    isa::utils::Bitmap first = randomBitmap(nrBits, 0, left);
+    isa::utils::Bitmap second = randomBitmap(nrBits, 17, right);
+    isa::utils::Bitmap andBitmap = first;
+    isa::utils::Bitmap orBitmap = first;
+    isa::utils::Bitmap xorBitmap = first;
+    isa::utils::Bitmap andNotBitmap = first;
+    std::size_t nrSet = 0;
+
+    andBitmap &= second;
+    orBitmap |= second;
+    xorBitmap ^= second;
+    andNotBitmap.andNot(second);
+    for ( std::size_t bit = 0; bit < nrBits; bit++ ) {
+      ASSERT_EQ(left.at(bit) && right.at(bit), andBitmap.test(bit));
+      ASSERT_EQ(left.at(bit) || right.at(bit), orBitmap.test(bit));
+      ASSERT_EQ(left.at(bit) != right.at(bit), xorBitmap.test(bit));
+      ASSERT_EQ(left.at(bit) && !right.at(bit), andNotBitmap.test(bit));
+      nrSet += left.at(bit) ? 1 : 0;
+    }
+    EXPECT_EQ(nrSet, first.count());
+    EXPECT_THROW(first &= isa::utils::Bitmap(nrBits + 1), isa::utils::BitmapError);
+  });
+}
+
+TEST(BitmapTest, Find) {
+  std::vector<bool> reference;
+  isa::utils::Bitmap bitmap = randomBitmap(5000, 3, reference);
+  std::vector<std::size_t> expected;
+  std::vector<std::size_t> found;
+
+  for ( std::size_t bit = 0; bit < reference.size(); bit++ ) {
+    if ( reference.at(bit) ) {
+      expected.push_back(bit);
+    }
+  }
+  for ( std::size_t bit = bitmap.findFirst(); bit != isa::utils::Bitmap::npos; bit = bitmap.findNext(bit) ) {
+    found.push_back(bit);
+  }
+  EXPECT_EQ(expected, found);
+  EXPECT_EQ(isa::utils::Bitmap::npos, isa::utils::Bitmap(1000).findFirst());
+  isa::utils::Bitmap last(1000);
+  last.set(999);
+  EXPECT_EQ(999, last.findFirst());
+  EXPECT_EQ(isa::utils::Bitmap::npos, last.findNext(999));
+}
+
+TEST(BitmapTest, ApplyMask) {
+  forEachKernel([]() {
+    for ( std::size_t nrSamples : {0, 5, 16, 33, 1000, 4103} ) {
+      std::vector<bool> reference;
+      isa::utils::Bitmap mask = randomBitmap(nrSamples, 5, reference);
+      std::vector<float> data(nrSamples);
+
+      for ( std::size_t sample = 0; sample < nrSamples; sample++ ) {
+        data.at(sample) = sample + 1.0f;
+      }
+      isa::utils::applyMask(mask, data.data(), -1.0f);
+      for ( std::size_t sample = 0; sample < nrSamples; sample++ ) {
+        ASSERT_EQ(reference.at(sample) ? -1.0f : sample + 1.0f, data.at(sample)) << "Sample: " << sample;
+      }
+    }
+  });
+}
+
+TEST(BitmapTest, Compact) {
+  forEachKernel([]() {
+    for ( std::size_t nrSamples : {0, 5, 16, 33, 1000, 4103} ) {
+      std::vector<bool> reference;
+      isa::utils::Bitmap mask = randomBitmap(nrSamples, 11, reference);
+      std::vector<float> data(nrSamples);
+      std::vector<float> output(nrSamples);
+      std::vector<float> expected;
+
+      for ( std::size_t sample = 0; sample < nrSamples; sample++ ) {
+        data.at(sample) = sample + 1.0f;
+        if ( !reference.at(sample) ) {
+          expected.push_back(data.at(sample));
+        }
+      }
+      ASSERT_EQ(expected.size(), isa::utils::compact(mask, data.data(), output.data()));
+      output.resize(expected.size());
+      EXPECT_EQ(expected, output);
+      // In place
+      ASSERT_EQ(expected.size(), isa::utils::compact(mask, data.data(), data.data()));
+      data.resize(expected.size());
+      EXPECT_EQ(expected, data);
+    }
+  });
+}
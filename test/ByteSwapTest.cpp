@@ -0,0 +1,115 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ByteSwap.hpp>
+#include <utils.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cstring>
+
+TEST(ByteSwapTest, SixteenBits) {
+  // Odd sizes exercise the scalar tail after the vector kernels
+  for ( std::size_t nrElements : {0, 1, 7, 8, 33, 1027} ) {
+    std::vector<std::uint16_t> data(nrElements);
+    std::vector<std::uint16_t> swapped(nrElements);
+
+    for ( std::size_t item = 0; item < nrElements; item++ ) {
+      data.at(item) = static_cast<std::uint16_t>((item * 2654435761u) & 0xffff);
+    }
+    isa::utils::byteSwap(data.data(), swapped.data(), nrElements);
+    for ( std::size_t item = 0; item < nrElements; item++ ) {
+      ASSERT_EQ(static_cast<std::uint16_t>((data.at(item) >> 8) | (data.at(item) << 8)), swapped.at(item)) << "Item: " << item;
+    }
+  }
+}
+
+TEST(ByteSwapTest, ThirtyTwoBits) {
+  for ( std::size_t nrElements : {1, 3, 16, 17, 255, 4099} ) {
+    std::vector<std::uint32_t> data(nrElements);
+    std::vector<std::uint32_t> expected(nrElements);
+
+    for ( std::size_t item = 0; item < nrElements; item++ ) {
+      data.at(item) = static_cast<std::uint32_t>(item * 2654435761u);
+      expected.at(item) = data.at(item);
+      isa::utils::bigEndianToLittleEndian(&(expected.at(item)));
+    }
+    isa::utils::byteSwap(data.data(), nrElements);
+    EXPECT_EQ(expected, data);
+  }
+}
+
+TEST(ByteSwapTest, SixtyFourBits) {
+  std::vector<std::uint64_t> data(131);
+
+  for ( std::size_t item = 0; item < data.size(); item++ ) {
+    data.at(item) = 0x0102030405060708ull + item;
+  }
+  isa::utils::byteSwap(data.data(), data.size());
+  EXPECT_EQ(0x0807060504030201ull, data.at(0));
+  EXPECT_EQ(0x0a07060504030201ull, data.at(2));
+  isa::utils::byteSwap(data.data(), data.size());
+  EXPECT_EQ(0x0102030405060708ull + 130, data.at(130));
+}
+
+TEST(ByteSwapTest, FloatingPoint) {
+  std::vector<float> singlePrecision(37, 932.728292f);
+  std::vector<double> doublePrecision(37, 932.728636126);
+  std::vector<float> swappedSingle(singlePrecision.size());
+  std::vector<double> swappedDouble(doublePrecision.size());
+
+  isa::utils::byteSwap(singlePrecision.data(), swappedSingle.data(), singlePrecision.size());
+  isa::utils::byteSwap(doublePrecision.data(), swappedDouble.data(), doublePrecision.size());
+  EXPECT_NE(0, std::memcmp(singlePrecision.data(), swappedSingle.data(), singlePrecision.size() * sizeof(float)));
+  isa::utils::byteSwap(swappedSingle.data(), swappedSingle.size());
+  isa::utils::byteSwap(swappedDouble.data(), swappedDouble.size());
+  EXPECT_EQ(singlePrecision, swappedSingle);
+  EXPECT_EQ(doublePrecision, swappedDouble);
+}
+
+TEST(ByteSwapTest, AllKernels) {
+  const isa::utils::ByteSwapKernel selected = isa::utils::getByteSwapKernel();
+
+  EXPECT_TRUE(isa::utils::isSupported(isa::utils::ByteSwapKernel::Scalar));
+  for ( auto kernel : {isa::utils::ByteSwapKernel::Scalar, isa::utils::ByteSwapKernel::SSSE3, isa::utils::ByteSwapKernel::AVX2, isa::utils::ByteSwapKernel::AVX512} ) {
+    if ( !isa::utils::setByteSwapKernel(kernel) ) {
+      EXPECT_FALSE(isa::utils::isSupported(kernel));
+      continue;
+    }
+    ASSERT_EQ(kernel, isa::utils::getByteSwapKernel());
+    // Sizes around the 16, 32 and 64 bytes steps of the vector kernels
+    for ( std::size_t nrElements : {1, 5, 8, 9, 16, 31, 33, 63, 64, 65, 200} ) {
+      std::vector<std::uint16_t> sixteen(nrElements);
+      std::vector<std::uint32_t> thirtyTwo(nrElements);
+      std::vector<std::uint64_t> sixtyFour(nrElements);
+      std::vector<std::uint16_t> swappedSixteen(nrElements);
+      std::vector<std::uint32_t> swappedThirtyTwo(nrElements);
+      std::vector<std::uint64_t> swappedSixtyFour(nrElements);
+
+      for ( std::size_t item = 0; item < nrElements; item++ ) {
+        sixtyFour.at(item) = (item + 1) * 0x9e3779b97f4a7c15ull;
+        thirtyTwo.at(item) = static_cast<std::uint32_t>(sixtyFour.at(item) >> 16);
+        sixteen.at(item) = static_cast<std::uint16_t>(sixtyFour.at(item) >> 40);
+      }
+      isa::utils::byteSwap(sixteen.data(), swappedSixteen.data(), nrElements);
+      isa::utils::byteSwap(thirtyTwo.data(), swappedThirtyTwo.data(), nrElements);
+      isa::utils::byteSwap(sixtyFour.data(), swappedSixtyFour.data(), nrElements);
+      for ( std::size_t item = 0; item < nrElements; item++ ) {
+        ASSERT_EQ(__builtin_bswap16(sixteen.at(item)), swappedSixteen.at(item)) << isa::utils::toString(kernel) << ", item " << item;
+        ASSERT_EQ(__builtin_bswap32(thirtyTwo.at(item)), swappedThirtyTwo.at(item)) << isa::utils::toString(kernel) << ", item " << item;
+        ASSERT_EQ(__builtin_bswap64(sixtyFour.at(item)), swappedSixtyFour.at(item)) << isa::utils::toString(kernel) << ", item " << item;
+      }
+    }
+  }
+  EXPECT_TRUE(isa::utils::setByteSwapKernel(selected));
+}
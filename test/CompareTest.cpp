@@ -0,0 +1,123 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Compare.hpp>
+#include <utils.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+template<typename T> std::vector<T> reference(const std::size_t nrElements) {
+  std::vector<T> values(nrElements);
+
+  for ( std::size_t element = 0; element < nrElements; element++ ) {
+    values.at(element) = static_cast<T>(std::sin(element * 0.001) * 100.0);
+  }
+
+  return values;
+}
+
+} // (anonymous)
+
+TEST(CompareTest, Identical) {
+  std::vector<float> expected = reference<float>(100003);
+  isa::utils::ComparisonResult result = isa::utils::compare(expected.data(), expected.data(), expected.size());
+
+  EXPECT_EQ(expected.size(), result.nrElements);
+  EXPECT_EQ(0, result.nrMismatches);
+  EXPECT_EQ(isa::utils::ComparisonResult::npos, result.firstMismatch);
+  EXPECT_EQ(isa::utils::ComparisonResult::npos, result.worstMismatch);
+  EXPECT_EQ(0.0, result.maxAbsoluteError);
+  EXPECT_EQ(0, result.maxRelativeError);
+}
+
+TEST(CompareTest, AgreesWithSame) {
+  std::vector<double> expected = reference<double>(20011);
+  std::vector<double> values(expected);
+  std::size_t nrMismatches = 0;
+
+  for ( std::size_t element = 0; element < values.size(); element += 7 ) {
+    values.at(element) += (element % 3) * 1.0e-06;
+  }
+  for ( std::size_t element = 0; element < values.size(); element++ ) {
+    nrMismatches += isa::utils::same(values.at(element), expected.at(element), 1.5e-06) ? 0 : 1;
+  }
+  isa::utils::ComparisonResult result = isa::utils::compare(values.data(), expected.data(), values.size(), {isa::utils::ToleranceMode::Absolute, 1.5e-06});
+  EXPECT_EQ(nrMismatches, result.nrMismatches);
+  EXPECT_EQ(14, result.firstMismatch);
+}
+
+TEST(CompareTest, Modes) {
+  std::vector<float> expected = reference<float>(10000);
+  std::vector<float> values(expected);
+
+  values.at(5000) = std::nextafter(std::nextafter(expected.at(5000), 1000.0f), 1000.0f);
+  values.at(9999) = expected.at(9999) * 1.01f;
+  values.at(2) = expected.at(2) + 0.5f;
+  isa::utils::ComparisonResult absolute = isa::utils::compare(values.data(), expected.data(), values.size(), {isa::utils::ToleranceMode::Absolute, 0.1});
+  EXPECT_EQ(2, absolute.nrMismatches);
+  EXPECT_EQ(2, absolute.firstMismatch);
+  EXPECT_FLOAT_EQ(std::abs(values.at(9999) - expected.at(9999)), absolute.maxAbsoluteError);
+  EXPECT_EQ(9999, absolute.worstMismatch);
+  isa::utils::ComparisonResult relative = isa::utils::compare(values.data(), expected.data(), values.size(), {isa::utils::ToleranceMode::Relative, 0.005});
+  EXPECT_EQ(2, relative.nrMismatches);
+  EXPECT_EQ(2, relative.worstMismatch);
+  isa::utils::ComparisonResult ulp = isa::utils::compare(values.data(), expected.data(), values.size(), {isa::utils::ToleranceMode::ULP, 1});
+  EXPECT_EQ(3, ulp.nrMismatches);
+  EXPECT_EQ(2, ulp.firstMismatch);
+  ulp = isa::utils::compare(values.data(), expected.data(), values.size(), {isa::utils::ToleranceMode::ULP, 2});
+  EXPECT_EQ(2, ulp.nrMismatches);
+}
+
+TEST(CompareTest, SpecialValues) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double infinity = std::numeric_limits<double>::infinity();
+  std::vector<double> values = {0.0, -0.0, nan, infinity, 1.0, nan, 1.0, -infinity, std::nextafter(0.0, 1.0)};
+  std::vector<double> expected = {-0.0, 0.0, nan, infinity, nan, 1.0, infinity, infinity, std::nextafter(0.0, -1.0)};
+  isa::utils::ComparisonResult result = isa::utils::compare(values.data(), expected.data(), values.size());
+
+  EXPECT_EQ(4, result.nrMismatches);
+  EXPECT_EQ(4, result.firstMismatch);
+  EXPECT_EQ(infinity, result.maxAbsoluteError);
+  EXPECT_EQ(0, result.maxULPError);
+  result = isa::utils::compare(values.data(), expected.data(), values.size(), {isa::utils::ToleranceMode::ULP, 0});
+  EXPECT_EQ(5, result.nrMismatches);
+  EXPECT_EQ(std::numeric_limits<std::uint64_t>::max(), result.maxULPError);
+  result = isa::utils::compare(values.data() + 8, expected.data() + 8, 1, {isa::utils::ToleranceMode::ULP, 1});
+  EXPECT_EQ(1, result.nrMismatches);
+  EXPECT_EQ(2, result.maxULPError);
+}
+
+TEST(CompareTest, Threads) {
+  std::vector<float> expected = reference<float>(1000003);
+  std::vector<float> values(expected);
+
+  for ( std::size_t element = 300001; element < values.size(); element += 100000 ) {
+    values.at(element) += element * 1.0e-06f;
+  }
+  isa::utils::ComparisonResult single = isa::utils::compare(values.data(), expected.data(), values.size(), {isa::utils::ToleranceMode::Absolute, 0.01});
+  for ( unsigned int nrThreads : {2, 3, 8} ) {
+    isa::utils::ComparisonResult parallel = isa::utils::compare(values.data(), expected.data(), values.size(), {isa::utils::ToleranceMode::Absolute, 0.01}, nrThreads);
+
+    EXPECT_EQ(8, parallel.nrMismatches);
+    EXPECT_EQ(single.nrMismatches, parallel.nrMismatches);
+    EXPECT_EQ(300001, parallel.firstMismatch);
+    EXPECT_EQ(single.worstMismatch, parallel.worstMismatch);
+    EXPECT_EQ(single.maxAbsoluteError, parallel.maxAbsoluteError);
+    EXPECT_EQ(single.maxULPError, parallel.maxULPError);
+  }
+}
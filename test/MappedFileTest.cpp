@@ -0,0 +1,107 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <MappedFile.hpp>
+#include <gtest/gtest.h>
+#include <limits>
+#include <fstream>
+#include <vector>
+#include <cstdio>
+
+namespace {
+
+// Records of a 32 bits big endian sample followed by a 16 bits native flag, 6 bytes each
+const std::string recordsPath = "MappedFileTest.dat";
+const std::size_t nrRecords = 1000;
+
+void writeRecords() {
+  std::ofstream output(recordsPath, std::ios::binary | std::ios::trunc);
+
+  for ( std::uint32_t record = 0; record < nrRecords; record++ ) {
+    unsigned char bytes[6] = {static_cast<unsigned char>(record >> 24), static_cast<unsigned char>(record >> 16), static_cast<unsigned char>(record >> 8), static_cast<unsigned char>(record), 0, 0};
+    std::uint16_t flag = static_cast<std::uint16_t>(record % 3);
+
+    std::memcpy(bytes + 4, &flag, sizeof(flag));
+    output.write(reinterpret_cast<const char *>(bytes), sizeof(bytes));
+  }
+}
+
+} // (anonymous)
+
+TEST(MappedFileTest, StridedRecords) {
+  writeRecords();
+  isa::utils::MappedFile file(recordsPath);
+
+  EXPECT_EQ(nrRecords * 6, file.getSize());
+  EXPECT_TRUE(file.advise(isa::utils::AccessPattern::Sequential));
+  isa::utils::RecordView<std::uint32_t> samples(file, isa::utils::Endianness::Big, 0, 6);
+  isa::utils::RecordView<std::uint16_t> flags(file, isa::utils::nativeEndianness(), 4, 6);
+  ASSERT_EQ(nrRecords, samples.size());
+  ASSERT_EQ(nrRecords, flags.size());
+  EXPECT_FALSE(samples.isZeroCopy());
+  for ( std::uint32_t record = 0; record < nrRecords; record++ ) {
+    ASSERT_EQ(record, samples[record]);
+    ASSERT_EQ(record % 3, flags.at(record));
+  }
+  std::vector<std::uint32_t> block(10);
+  samples.copy(500, block.size(), block.data());
+  EXPECT_EQ(509, block.at(9));
+  EXPECT_THROW(samples.at(nrRecords), isa::utils::MappedFileError);
+  EXPECT_THROW(samples.copy(995, 10, block.data()), isa::utils::MappedFileError);
+  // Arguments whose sum overflows are still out of range
+  const std::size_t maximum = std::numeric_limits<std::size_t>::max();
+  EXPECT_THROW(samples.copy(2, maximum, block.data()), isa::utils::MappedFileError);
+  EXPECT_THROW(samples.copy(maximum, 2, block.data()), isa::utils::MappedFileError);
+  EXPECT_THROW(isa::utils::RecordView<std::uint32_t>(file, isa::utils::Endianness::Big, maximum - 1, 6, 1), isa::utils::MappedFileError);
+  // An empty view past the end of the file
+  isa::utils::RecordView<std::uint32_t> empty(file, isa::utils::Endianness::Big, maximum - 1, 6);
+  EXPECT_EQ(0, empty.size());
+  EXPECT_NO_THROW(empty.copy(0, 0, block.data()));
+  EXPECT_TRUE(file.advise(isa::utils::AccessPattern::Random, 4096, maximum));
+  std::remove(recordsPath.c_str());
+}
+
+TEST(MappedFileTest, ContiguousValues) {
+  std::vector<double> values(4096);
+  const std::string valuesPath = "MappedFileTest.values";
+
+  for ( std::size_t item = 0; item < values.size(); item++ ) {
+    values.at(item) = item * 0.5;
+  }
+  {
+    std::ofstream output(valuesPath, std::ios::binary | std::ios::trunc);
+
+    output.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(double));
+  }
+  isa::utils::MappedFile file(valuesPath);
+  isa::utils::RecordView<double> native(file, isa::utils::nativeEndianness());
+  ASSERT_TRUE(native.isZeroCopy());
+  EXPECT_EQ(0, std::memcmp(values.data(), native.data(), values.size() * sizeof(double)));
+  // The same bytes read as the other byte order are swapped in bulk
+  isa::utils::RecordView<double> swapped(file, isa::utils::nativeEndianness() == isa::utils::Endianness::Little ? isa::utils::Endianness::Big : isa::utils::Endianness::Little);
+  std::vector<double> converted(values.size());
+  swapped.copy(0, converted.size(), converted.data());
+  EXPECT_THROW(swapped.data(), isa::utils::MappedFileError);
+  isa::utils::byteSwap(converted.data(), converted.size());
+  EXPECT_EQ(values, converted);
+  EXPECT_TRUE(isa::utils::byteSwap(swapped[7]) == values.at(7));
+  isa::utils::MappedFile moved(std::move(file));
+  EXPECT_EQ(nullptr, file.getData());
+  EXPECT_EQ(values.size() * sizeof(double), moved.getSize());
+  std::remove(valuesPath.c_str());
+}
+
+TEST(MappedFileTest, MissingFile) {
+  EXPECT_THROW(isa::utils::MappedFile("MappedFileTest.missing"), isa::utils::MappedFileError);
+}
@@ -0,0 +1,130 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Metrics.hpp>
+#include <utils.hpp>
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+
+namespace {
+
+std::string readFile(const std::string & path) {
+  std::ifstream input(path);
+  std::stringstream content;
+
+  content << input.rdbuf();
+  return content.str();
+}
+
+} // (anonymous)
+
+TEST(MetricsTest, PublishStatistics) {
+  isa::utils::MetricsRegistry registry;
+  isa::utils::Statistics<double> statistics;
+  auto & slot = registry.getSlot("samples");
+
+  statistics.addElement(1.0);
+  statistics.addElement(3.0);
+  slot.publish(statistics);
+  EXPECT_EQ(&slot, &registry.getSlot("samples"));
+  auto metrics = registry.snapshot();
+  ASSERT_EQ(1, metrics.size());
+  EXPECT_EQ(std::string("samples"), metrics.at(0).first);
+  EXPECT_EQ(2, metrics.at(0).second.nrElements);
+  EXPECT_TRUE(isa::utils::same(2.0, metrics.at(0).second.mean));
+  EXPECT_TRUE(isa::utils::same(4.0, metrics.at(0).second.total));
+  EXPECT_TRUE(isa::utils::same(1.0, metrics.at(0).second.min));
+  EXPECT_TRUE(isa::utils::same(3.0, metrics.at(0).second.max));
+}
+
+TEST(MetricsTest, ConcurrentPublish) {
+  isa::utils::MetricSlot slot;
+  std::atomic<bool> done(false);
+  std::thread writer([&slot, &done]() {
+    isa::utils::MetricSnapshot snapshot;
+
+    for ( std::uint64_t item = 1; item <= 100000; item++ ) {
+      snapshot.nrElements = item;
+      snapshot.total = item;
+      snapshot.mean = item;
+      snapshot.min = item;
+      snapshot.max = item;
+      slot.publish(snapshot);
+    }
+    done = true;
+  });
+
+  while ( !done ) {
+    auto snapshot = slot.read();
+
+    // Every field is written with the same value, a torn read would show different ones
+    ASSERT_EQ(static_cast<double>(snapshot.nrElements), snapshot.total);
+    ASSERT_EQ(snapshot.total, snapshot.mean);
+    ASSERT_EQ(snapshot.mean, snapshot.min);
+    ASSERT_EQ(snapshot.min, snapshot.max);
+  }
+  writer.join();
+  EXPECT_EQ(100000, slot.read().nrElements);
+}
+
+TEST(MetricsTest, ExportFormats) {
+  isa::utils::MetricsRegistry registry;
+  isa::utils::Timer timer;
+  const std::string csvPath = "MetricsTest.csv";
+  const std::string jsonPath = "MetricsTest.jsonl";
+  const std::string prometheusPath = "MetricsTest.prom";
+
+  std::remove(csvPath.c_str());
+  std::remove(jsonPath.c_str());
+  timer.start();
+  timer.stop();
+  registry.getSlot("kernel").publish(timer);
+  {
+    isa::utils::MetricsExporter csv(registry, csvPath, isa::utils::MetricsFormat::CSV, std::chrono::milliseconds(1));
+    isa::utils::MetricsExporter json(registry, jsonPath, isa::utils::MetricsFormat::JSONLines, std::chrono::milliseconds(1000));
+    isa::utils::MetricsExporter prometheus(registry, prometheusPath, isa::utils::MetricsFormat::Prometheus, std::chrono::milliseconds(1000));
+
+    csv.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    csv.stop();
+    EXPECT_LE(2, csv.getNrExports());
+    EXPECT_EQ(0, csv.getNrErrors());
+    EXPECT_TRUE(json.exportNow());
+    EXPECT_TRUE(prometheus.exportNow());
+  }
+  std::string csv = readFile(csvPath);
+  EXPECT_EQ(0, csv.find("timestamp,name,count,total,mean,stddev,min,max\n"));
+  EXPECT_EQ(csv.find("timestamp"), csv.rfind("timestamp"));
+  EXPECT_NE(std::string::npos, csv.find(",\"kernel\",1,"));
+  std::string json = readFile(jsonPath);
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"kernel\",\"count\":1,"));
+  std::string prometheus = readFile(prometheusPath);
+  EXPECT_NE(std::string::npos, prometheus.find("# TYPE isa_utils_metric_mean gauge\n"));
+  EXPECT_NE(std::string::npos, prometheus.find("isa_utils_metric_count{name=\"kernel\"} 1\n"));
+  std::remove(jsonPath.c_str());
+  std::remove(prometheusPath.c_str());
+  // Appending to the same file does not repeat the header, and quotes are doubled as in RFC 4180
+  registry.getSlot("say \"hi\"").publish(timer);
+  {
+    isa::utils::MetricsExporter append(registry, csvPath, isa::utils::MetricsFormat::CSV, std::chrono::milliseconds(1000));
+
+    EXPECT_TRUE(append.exportNow());
+  }
+  csv = readFile(csvPath);
+  EXPECT_EQ(csv.find("timestamp"), csv.rfind("timestamp"));
+  EXPECT_NE(std::string::npos, csv.find(",\"say \"\"hi\"\"\",1,"));
+  std::remove(csvPath.c_str());
+}
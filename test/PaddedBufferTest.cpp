@@ -0,0 +1,96 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <PaddedBuffer.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cstdint>
+
+TEST(PaddedBufferTest, AlignedAllocator) {
+  std::vector<double, isa::utils::AlignedAllocator<double, 128>> values(1000, 1.0);
+
+  EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(values.data()) % 128);
+  values.resize(100000);
+  EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(values.data()) % 128);
+  EXPECT_EQ(1.0, values.at(999));
+}
+
+TEST(PaddedBufferTest, PitchedLayout) {
+  isa::utils::PaddedBuffer<float> buffer(100, 3, 2);
+
+  static_assert(isa::utils::PaddedBuffer<float>::getPitch(100) == 112, "Rows of floats are padded to 16 elements");
+  static_assert(isa::utils::PaddedBuffer<float>::hasAlignedRows(), "Rows of floats are aligned by default");
+  static_assert(!isa::utils::PaddedBuffer<float, 3>::hasAlignedRows(), "Rows padded to 3 floats are not aligned");
+  EXPECT_EQ(112, buffer.getPitch());
+  EXPECT_EQ(112 * 3 * 2, buffer.size());
+  EXPECT_EQ(buffer.size() * sizeof(float), buffer.getBytes());
+  for ( std::size_t z = 0; z < buffer.getDepth(); z++ ) {
+    for ( std::size_t y = 0; y < buffer.getHeight(); y++ ) {
+      ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(buffer.getRow(y, z)) % 64);
+      for ( std::size_t x = 0; x < buffer.getWidth(); x++ ) {
+        ASSERT_EQ(0.0f, buffer(x, y, z));
+        buffer(x, y, z) = static_cast<float>((z * 1000) + (y * 100) + x);
+      }
+    }
+  }
+  EXPECT_EQ(1299.0f, buffer.getRow(2, 1)[99]);
+  EXPECT_EQ(0.0f, buffer.getRow(2, 1)[100]);
+  isa::utils::PaddedBuffer<float> moved(std::move(buffer));
+  EXPECT_EQ(nullptr, buffer.data());
+  EXPECT_EQ(1299.0f, moved(99, 2, 1));
+}
+
+TEST(PaddedBufferTest, CacheLineRows) {
+  struct Triple {
+    float x;
+    float y;
+    float z;
+  };
+  isa::utils::PaddedBuffer<Triple> triples(5, 4);
+  isa::utils::PaddedBuffer<std::uint8_t> bytes(5, 4);
+
+  static_assert(isa::utils::getCacheLinePadding<Triple>() == 16, "16 elements of 12 bytes are three cache lines");
+  static_assert(isa::utils::getCacheLinePadding<double>() == 8, "8 doubles are a cache line");
+  static_assert(isa::utils::PaddedBuffer<Triple>::hasAlignedRows(), "Rows of 12 bytes elements are aligned by default");
+  for ( std::size_t y = 0; y < triples.getHeight(); y++ ) {
+    ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(triples.getRow(y)) % 64);
+    ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(bytes.getRow(y)) % 64);
+  }
+}
+
+TEST(PaddedBufferTest, PlacementOptions) {
+  isa::utils::BufferOptions options;
+
+  options.hugePages = true;
+  options.nrThreads = 4;
+  isa::utils::PaddedBuffer<std::int16_t, 7, 16> buffer(10, 33);
+  isa::utils::PaddedBuffer<std::int16_t, 7, 16> placed(10, 33, 1, options);
+  EXPECT_EQ(14, placed.getPitch());
+  EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(placed.data()) % 2097152);
+  for ( std::size_t y = 0; y < placed.getHeight(); y++ ) {
+    for ( std::size_t x = 0; x < placed.getPitch(); x++ ) {
+      ASSERT_EQ(0, placed(x, y));
+    }
+  }
+  // First-touch threads pinned to an explicit list of CPUs
+  options.hugePages = false;
+  options.nrThreads = 3;
+  options.cpus = {0};
+  isa::utils::PaddedBuffer<float> pinned(100, 10, 1, options);
+  for ( std::size_t y = 0; y < pinned.getHeight(); y++ ) {
+    for ( std::size_t x = 0; x < pinned.getPitch(); x++ ) {
+      ASSERT_EQ(0.0f, pinned(x, y));
+    }
+  }
+}
@@ -0,0 +1,199 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <SourceCache.hpp>
+#include <utils.hpp>
+#include <gtest/gtest.h>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <unistd.h>
+
+namespace {
+
+const std::string kernelTemplate = "__kernel void scale<%NAME%>(__global float * data) {\n"
+  "  data[get_global_id(0)] *= <%FACTOR%>;\n"
+  "  <%UNROLL%>\n"
+  "}\n";
+
+isa::utils::Substitutions getSubstitutions(const unsigned int configuration) {
+  return {{"<%NAME%>", std::to_string(configuration)}, {"<%FACTOR%>", std::to_string(configuration) + ".0f"}, {"<%UNROLL%>", std::string(configuration % 7, ';')}};
+}
+
+std::string makeDirectory() {
+  char path[] = "SourceCacheTest.XXXXXX";
+
+  if ( mkdtemp(path) == nullptr ) {
+    return "";
+  }
+  return path;
+}
+
+void removeDirectory(const std::string & directory, const unsigned int nrConfigurations) {
+  for ( unsigned int configuration = 0; configuration < nrConfigurations; configuration++ ) {
+    std::remove((directory + "/" + isa::utils::hashSource(kernelTemplate, getSubstitutions(configuration)).toString() + ".src").c_str());
+  }
+  rmdir(directory.c_str());
+}
+
+} // (anonymous)
+
+TEST(SourceCacheTest, Keys) {
+  isa::utils::Substitutions substitutions = getSubstitutions(3);
+  isa::utils::SourceKey key = isa::utils::hashSource(kernelTemplate, substitutions);
+
+  EXPECT_EQ(key, isa::utils::hashSource(kernelTemplate, getSubstitutions(3)));
+  EXPECT_EQ(key, isa::utils::hashSource(isa::utils::hashTemplate(kernelTemplate), substitutions));
+  EXPECT_EQ(key, isa::utils::hashSource(isa::utils::SourceTemplate(kernelTemplate).getKey(), substitutions));
+  EXPECT_NE(key, isa::utils::hashSource(kernelTemplate, getSubstitutions(4)));
+  EXPECT_NE(key, isa::utils::hashSource(kernelTemplate + " ", substitutions));
+  EXPECT_EQ(32, key.toString().size());
+  // Order and boundaries of the substitutions are part of the key
+  std::swap(substitutions.at(0), substitutions.at(1));
+  EXPECT_NE(key, isa::utils::hashSource(kernelTemplate, substitutions));
+  EXPECT_NE(isa::utils::hashSource("x", {{"a", "bc"}}), isa::utils::hashSource("x", {{"ab", "c"}}));
+  EXPECT_NE(isa::utils::hashSource("x", {{"a", "b"}}), isa::utils::hashSource("xa", {{"", "b"}}));
+  isa::utils::SourceKey reference;
+  reference.high = 0x6c62272e07bb0142ULL;
+  reference.low = 0x62b821756295c58dULL;
+  EXPECT_EQ("6c62272e07bb014262b821756295c58d", reference.toString());
+  EXPECT_NE(isa::utils::hashTemplate(""), isa::utils::hashTemplate(std::string(1, '\0')));
+}
+
+TEST(SourceCacheTest, Render) {
+  isa::utils::Substitutions substitutions = getSubstitutions(5);
+  std::string * expected = new std::string(kernelTemplate);
+
+  for ( const auto & substitution : substitutions ) {
+    expected = isa::utils::replace(expected, substitution.first, substitution.second, true);
+  }
+  EXPECT_EQ(*expected, isa::utils::render(kernelTemplate, substitutions));
+  EXPECT_EQ(kernelTemplate, isa::utils::render(kernelTemplate, {}));
+  delete expected;
+}
+
+TEST(SourceCacheTest, HitsAndMisses) {
+  isa::utils::SourceCache cache(1024);
+  isa::utils::SourceTemplate sourceTemplate(kernelTemplate);
+
+  for ( unsigned int sweep = 0; sweep < 3; sweep++ ) {
+    for ( unsigned int configuration = 0; configuration < 32; configuration++ ) {
+      auto source = cache.get(sourceTemplate, getSubstitutions(configuration));
+
+      ASSERT_EQ(isa::utils::render(kernelTemplate, getSubstitutions(configuration)), *source);
+    }
+  }
+  EXPECT_EQ(32, cache.getNrMisses());
+  EXPECT_EQ(64, cache.getNrHits());
+  EXPECT_EQ(0, cache.getNrDiskHits());
+  EXPECT_EQ(0, cache.getNrEvictions());
+  EXPECT_EQ(32, cache.getNrEntries());
+  EXPECT_DOUBLE_EQ(64.0 / 96.0, cache.getHitRate());
+  // The same source is found with and without the precomputed template key
+  EXPECT_EQ(cache.get(sourceTemplate, getSubstitutions(1)), cache.get(kernelTemplate, getSubstitutions(1)));
+  cache.clear();
+  EXPECT_EQ(0, cache.getNrEntries());
+  cache.get(kernelTemplate, getSubstitutions(1));
+  EXPECT_EQ(33, cache.getNrMisses());
+}
+
+TEST(SourceCacheTest, LeastRecentlyUsed) {
+  isa::utils::SourceCache cache(2, "", 1);
+
+  auto first = cache.get(kernelTemplate, getSubstitutions(1));
+  cache.get(kernelTemplate, getSubstitutions(2));
+  // Touching the first source makes the second one the least recently used
+  cache.get(kernelTemplate, getSubstitutions(1));
+  cache.get(kernelTemplate, getSubstitutions(3));
+  EXPECT_EQ(1, cache.getNrEvictions());
+  EXPECT_EQ(2, cache.getNrEntries());
+  cache.get(kernelTemplate, getSubstitutions(1));
+  EXPECT_EQ(2, cache.getNrHits());
+  cache.get(kernelTemplate, getSubstitutions(2));
+  EXPECT_EQ(4, cache.getNrMisses());
+  // Evicted sources are still valid
+  EXPECT_EQ(isa::utils::render(kernelTemplate, getSubstitutions(1)), *first);
+  // Without in-memory tier, every lookup generates the source
+  isa::utils::SourceCache uncached(0);
+  uncached.get(kernelTemplate, getSubstitutions(1));
+  uncached.get(kernelTemplate, getSubstitutions(1));
+  EXPECT_EQ(2, uncached.getNrMisses());
+  EXPECT_EQ(0, uncached.getNrEntries());
+}
+
+TEST(SourceCacheTest, Disk) {
+  std::string directory = makeDirectory();
+  ASSERT_FALSE(directory.empty());
+
+  {
+    isa::utils::SourceCache cache(1024, directory);
+
+    for ( unsigned int configuration = 0; configuration < 8; configuration++ ) {
+      cache.get(kernelTemplate, getSubstitutions(configuration));
+    }
+    EXPECT_EQ(8, cache.getNrMisses());
+  }
+  // A different cache, e.g. in another process, finds the sources on disk
+  {
+    isa::utils::SourceCache cache(1024, directory);
+
+    for ( unsigned int configuration = 0; configuration < 8; configuration++ ) {
+      ASSERT_EQ(isa::utils::render(kernelTemplate, getSubstitutions(configuration)), *cache.get(kernelTemplate, getSubstitutions(configuration)));
+    }
+    cache.get(kernelTemplate, getSubstitutions(0));
+    EXPECT_EQ(0, cache.getNrMisses());
+    EXPECT_EQ(8, cache.getNrDiskHits());
+    EXPECT_EQ(1, cache.getNrHits());
+  }
+  std::ifstream file(directory + "/" + isa::utils::hashSource(kernelTemplate, getSubstitutions(3)).toString() + ".src");
+  EXPECT_TRUE(file.good());
+  EXPECT_THROW(isa::utils::SourceCache(16, directory + "/" + isa::utils::hashSource(kernelTemplate, getSubstitutions(3)).toString() + ".src"), isa::utils::SourceCacheError);
+  EXPECT_THROW(isa::utils::SourceCache(16, directory + "/missing/subdirectory"), isa::utils::SourceCacheError);
+  file.close();
+  removeDirectory(directory, 8);
+  EXPECT_NE(0, access(directory.c_str(), F_OK));
+}
+
+TEST(SourceCacheTest, Concurrent) {
+  isa::utils::SourceCache cache(1024);
+  isa::utils::SourceTemplate sourceTemplate(kernelTemplate);
+  std::vector<std::thread> threads;
+  const unsigned int nrThreads = 4;
+  const unsigned int nrConfigurations = 200;
+  std::vector<unsigned int> nrErrors(nrThreads, 0);
+
+  for ( unsigned int thread = 0; thread < nrThreads; thread++ ) {
+    threads.emplace_back([&, thread]() {
+      for ( unsigned int sweep = 0; sweep < 5; sweep++ ) {
+        for ( unsigned int configuration = 0; configuration < nrConfigurations; configuration++ ) {
+          if ( *cache.get(sourceTemplate, getSubstitutions(configuration)) != isa::utils::render(kernelTemplate, getSubstitutions(configuration)) ) {
+            nrErrors.at(thread)++;
+          }
+        }
+      }
+    });
+  }
+  for ( auto & thread : threads ) {
+    thread.join();
+  }
+  for ( auto errors : nrErrors ) {
+    EXPECT_EQ(0, errors);
+  }
+  EXPECT_EQ(nrThreads * nrConfigurations * 5, cache.getNrHits() + cache.getNrMisses());
+  EXPECT_GE(cache.getNrMisses(), nrConfigurations);
+  EXPECT_EQ(nrConfigurations, cache.getNrEntries());
+}
@@ -0,0 +1,159 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StreamReader.hpp>
+#include <gtest/gtest.h>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+#include <ctime>
+
+namespace {
+
+// 10000 big endian 16 bits samples; 20000 bytes, not a multiple of the block size
+const std::string streamPath = "StreamReaderTest.dat";
+const std::size_t nrSamples = 10000;
+
+void writeSamples() {
+  std::ofstream output(streamPath, std::ios::binary | std::ios::trunc);
+
+  for ( std::size_t sample = 0; sample < nrSamples; sample++ ) {
+    std::int16_t value = static_cast<std::int16_t>(sample - 5000);
+    char bytes[2] = {static_cast<char>((value >> 8) & 0xff), static_cast<char>(value & 0xff)};
+
+    output.write(bytes, sizeof(bytes));
+  }
+}
+
+} // (anonymous)
+
+TEST(StreamReaderTest, PlainBlocks) {
+  writeSamples();
+  isa::utils::StreamReader reader(streamPath, 4096, 3);
+  isa::utils::StreamBlock block;
+  std::size_t nrBytes = 0;
+  std::uint64_t nrBlocks = 0;
+
+  reader.start();
+  while ( reader.next(block) ) {
+    EXPECT_EQ(nrBlocks, block.index);
+    EXPECT_EQ(nrBytes, block.offset);
+    nrBytes += block.size;
+    nrBlocks++;
+    reader.release(block);
+  }
+  EXPECT_EQ(nrSamples * sizeof(std::int16_t), nrBytes);
+  EXPECT_EQ(5, nrBlocks);
+  EXPECT_EQ(5, reader.getReadTimer().getNrRuns());
+  EXPECT_FALSE(reader.next(block));
+}
+
+TEST(StreamReaderTest, WideningStage) {
+  writeSamples();
+  // Buffers large enough to widen 16 bits integers to 32 bits floats in place
+  isa::utils::StreamReader reader(streamPath, 4096, 4, true, 8192);
+  isa::utils::StreamBlock block;
+  std::vector<float> samples;
+
+  reader.setConversion(isa::utils::widenStage<std::int16_t, float>(isa::utils::Endianness::Big));
+  reader.start();
+  while ( reader.next(block) ) {
+    const float * values = reinterpret_cast<const float *>(block.data);
+
+    samples.insert(samples.end(), values, values + (block.size / sizeof(float)));
+    reader.release(block);
+  }
+  ASSERT_EQ(nrSamples, samples.size());
+  for ( std::size_t sample = 0; sample < nrSamples; sample++ ) {
+    ASSERT_EQ(static_cast<float>(static_cast<int>(sample) - 5000), samples.at(sample));
+  }
+  EXPECT_EQ(5, reader.getConversionTimer().getNrRuns());
+}
+
+TEST(StreamReaderTest, ByteSwapStage) {
+  writeSamples();
+  isa::utils::StreamReader reader(streamPath, 1000, 2);
+  isa::utils::StreamBlock block;
+  std::vector<std::int16_t> samples;
+
+  reader.setConversion(isa::utils::byteSwapStage<std::int16_t>());
+  reader.start();
+  while ( reader.next(block) ) {
+    const std::int16_t * values = reinterpret_cast<const std::int16_t *>(block.data);
+
+    samples.insert(samples.end(), values, values + (block.size / sizeof(std::int16_t)));
+    reader.release(block);
+  }
+  ASSERT_EQ(nrSamples, samples.size());
+  EXPECT_EQ(-5000, samples.front());
+  EXPECT_EQ(4999, samples.back());
+  // A partial element is not part of the converted block
+  unsigned char partial[5] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  EXPECT_EQ(4, isa::utils::byteSwapStage<std::int16_t>()(partial, 5, 5));
+  EXPECT_EQ(0x02, partial[0]);
+  EXPECT_EQ(0x03, partial[3]);
+}
+
+TEST(StreamReaderTest, ConversionError) {
+  writeSamples();
+  isa::utils::StreamReader reader(streamPath, 4096, 2);
+  isa::utils::StreamBlock block;
+
+  // The buffers are too small to widen in place
+  reader.setConversion(isa::utils::widenStage<std::int16_t, double>(isa::utils::Endianness::Big));
+  reader.start();
+  EXPECT_THROW(reader.next(block), isa::utils::StreamError);
+  std::remove(streamPath.c_str());
+}
+
+TEST(StreamReaderTest, EarlyDestruction) {
+  writeSamples();
+  {
+    isa::utils::StreamReader reader(streamPath, 512, 2);
+    isa::utils::StreamBlock block;
+
+    reader.start();
+    ASSERT_TRUE(reader.next(block));
+  }
+  EXPECT_THROW(isa::utils::StreamReader("StreamReaderTest.missing", 512), isa::utils::StreamError);
+  std::remove(streamPath.c_str());
+}
+
+TEST(StreamReaderTest, IdleStages) {
+  writeSamples();
+  isa::utils::StreamReader reader(streamPath, 4096, 2);
+  isa::utils::StreamBlock first;
+  isa::utils::StreamBlock second;
+  isa::utils::StreamBlock block;
+
+  reader.setConversion(isa::utils::byteSwapStage<std::int16_t>());
+  reader.start();
+  ASSERT_TRUE(reader.next(first));
+  ASSERT_TRUE(reader.next(second));
+  // Both buffers are held by the consumer, the reader and the converter must sleep instead of spinning
+  std::clock_t before = std::clock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  double busy = static_cast<double>(std::clock() - before) / CLOCKS_PER_SEC;
+  EXPECT_LT(busy, 0.05) << "CPU time: " << busy << " s";
+  reader.release(first);
+  reader.release(second);
+  std::uint64_t nrBlocks = 2;
+  while ( reader.next(block) ) {
+    nrBlocks++;
+    reader.release(block);
+  }
+  EXPECT_EQ(5, nrBlocks);
+}
@@ -0,0 +1,194 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <TaskPool.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+TEST(TaskPoolTest, Deque) {
+  isa::utils::WorkStealingDeque deque;
+  std::size_t begin = 0;
+  std::size_t end = 0;
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop(begin, end));
+  EXPECT_FALSE(deque.steal(begin, end));
+  for ( std::size_t item = 0; item < isa::utils::WorkStealingDeque::capacity; item++ ) {
+    ASSERT_TRUE(deque.push(item, item + 1));
+  }
+  EXPECT_FALSE(deque.push(0, 1));
+  // The owner pops the most recent range, thieves steal the oldest one
+  ASSERT_TRUE(deque.pop(begin, end));
+  EXPECT_EQ(isa::utils::WorkStealingDeque::capacity - 1, begin);
+  ASSERT_TRUE(deque.steal(begin, end));
+  EXPECT_EQ(0, begin);
+  EXPECT_EQ(1, end);
+  for ( std::size_t item = 1; item < isa::utils::WorkStealingDeque::capacity - 1; item++ ) {
+    ASSERT_TRUE(deque.steal(begin, end));
+    ASSERT_EQ(item, begin);
+  }
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop(begin, end));
+}
+
+TEST(TaskPoolTest, EveryIterationOnce) {
+  isa::utils::TaskPool pool(4);
+
+  EXPECT_EQ(4, pool.getNrWorkers());
+  for ( std::size_t nrIterations : {1, 3, 100, 10007} ) {
+    for ( std::size_t grainSize : {0, 1, 7, 20000} ) {
+      std::vector<std::atomic<unsigned int>> counters(nrIterations);
+
+      for ( auto & counter : counters ) {
+        counter.store(0);
+      }
+      pool.parallelFor(5, 5 + nrIterations, [&](std::size_t first, std::size_t last) {
+        for ( std::size_t item = first; item < last; item++ ) {
+          counters.at(item - 5)++;
+        }
+      }, grainSize);
+      for ( std::size_t item = 0; item < nrIterations; item++ ) {
+        ASSERT_EQ(1, counters.at(item).load()) << nrIterations << " iterations, grain " << grainSize << ", item " << item;
+      }
+    }
+  }
+  // Empty ranges do nothing
+  pool.parallelFor(10, 10, [](std::size_t, std::size_t) {
+    FAIL();
+  });
+}
+
+TEST(TaskPoolTest, PerWorkerData) {
+  isa::utils::TaskPool pool(3);
+  std::vector<std::uint64_t> sums(pool.getNrWorkers(), 0);
+  const std::size_t nrIterations = 100000;
+
+  pool.parallelFor(0, nrIterations, [&](std::size_t first, std::size_t last, unsigned int worker) {
+    for ( std::size_t item = first; item < last; item++ ) {
+      sums.at(worker) += item;
+    }
+  });
+  std::uint64_t total = 0;
+
+  for ( auto sum : sums ) {
+    total += sum;
+  }
+  EXPECT_EQ((nrIterations * (nrIterations - 1)) / 2, total);
+  isa::utils::WorkerStatistics statistics = pool.getTotalStatistics();
+  std::uint64_t nrRuns = 0;
+
+  for ( unsigned int worker = 0; worker < pool.getNrWorkers(); worker++ ) {
+    nrRuns += pool.getTimer(worker).getNrRuns();
+    EXPECT_EQ(pool.getStatistics(worker).nrTasks, pool.getTimer(worker).getNrRuns());
+  }
+  EXPECT_EQ(nrIterations, statistics.nrIterations);
+  EXPECT_EQ(nrRuns, statistics.nrTasks);
+  EXPECT_GE(pool.getImbalance(), 1.0);
+  pool.resetStatistics();
+  EXPECT_EQ(0, pool.getTotalStatistics().nrIterations);
+  EXPECT_EQ(0, pool.getTimer(0).getNrRuns());
+}
+
+TEST(TaskPoolTest, Stealing) {
+  isa::utils::TaskPool pool(4);
+  std::atomic<std::size_t> nrExecuted(0);
+
+  // All the expensive iterations are in the block of the first worker, the others have to steal them
+  pool.parallelFor(0, 400, [&](std::size_t first, std::size_t last) {
+    for ( std::size_t item = first; item < last; item++ ) {
+      if ( item < 100 ) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+      }
+      nrExecuted++;
+    }
+  }, 1);
+  EXPECT_EQ(400, nrExecuted.load());
+  isa::utils::WorkerStatistics statistics = pool.getTotalStatistics();
+
+  EXPECT_GT(statistics.nrSteals, 0);
+  EXPECT_GT(statistics.busyTime, 0.0);
+  EXPECT_GE(statistics.idleTime, 0.0);
+  EXPECT_EQ(400, statistics.nrTasks);
+}
+
+TEST(TaskPoolTest, Exceptions) {
+  isa::utils::TaskPool pool(4);
+  std::atomic<std::size_t> nrExecuted(0);
+
+  EXPECT_THROW(pool.parallelFor(0, 1000, [&](std::size_t first, std::size_t last) {
+    for ( std::size_t item = first; item < last; item++ ) {
+      if ( item == 500 ) {
+        throw std::runtime_error("ERROR: iteration 500");
+      }
+      nrExecuted++;
+    }
+  }, 10), std::runtime_error);
+  EXPECT_LT(nrExecuted.load(), 1000);
+  // The pool is still usable
+  nrExecuted = 0;
+  pool.parallelFor(0, 1000, [&](std::size_t first, std::size_t last) {
+    nrExecuted += last - first;
+  });
+  EXPECT_EQ(1000, nrExecuted.load());
+}
+
+TEST(TaskPoolTest, Nested) {
+  isa::utils::TaskPool pool(4);
+  isa::utils::TaskPool inner(2);
+  std::atomic<std::size_t> nrExecuted(0);
+
+  pool.parallelFor(0, 16, [&](std::size_t first, std::size_t last) {
+    for ( std::size_t item = first; item < last; item++ ) {
+      // Executed serially by the calling worker
+      pool.parallelFor(0, 10, [&](std::size_t innerFirst, std::size_t innerLast) {
+        nrExecuted += innerLast - innerFirst;
+      });
+    }
+  }, 1);
+  EXPECT_EQ(160, nrExecuted.load());
+  // A different pool, called from the workers of this one
+  nrExecuted = 0;
+  pool.parallelFor(0, 4, [&](std::size_t, std::size_t) {
+    inner.parallelFor(0, 100, [&](std::size_t innerFirst, std::size_t innerLast) {
+      nrExecuted += innerLast - innerFirst;
+    });
+  }, 1);
+  EXPECT_EQ(400, nrExecuted.load());
+}
+
+TEST(TaskPoolTest, SingleWorkerAndPinning) {
+  isa::utils::TaskPool single(1);
+  std::size_t nrExecuted = 0;
+
+  single.parallelFor(0, 1000, [&](std::size_t first, std::size_t last) {
+    nrExecuted += last - first;
+  });
+  EXPECT_EQ(1000, nrExecuted);
+  EXPECT_EQ(0, single.getTotalStatistics().nrSteals);
+  isa::utils::TaskPool pinned(3, true);
+  std::atomic<std::size_t> nrPinnedExecuted(0);
+
+  EXPECT_LE(pinned.getNrPinnedWorkers(), 2);
+  pinned.parallelFor(0, 1000, [&](std::size_t first, std::size_t last) {
+    nrPinnedExecuted += last - first;
+  });
+  EXPECT_EQ(1000, nrPinnedExecuted.load());
+  // The default is the number of hardware threads
+  isa::utils::TaskPool automatic;
+  EXPECT_GE(automatic.getNrWorkers(), 1);
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Throughput.hpp>
+#include <gtest/gtest.h>
+
+TEST(ThroughputTest, RatesAndIntensity) {
+  isa::utils::Throughput throughput(2000000000, 1000000000);
+
+  throughput.addRun(1.0, 2000000000, 1000000000);
+  throughput.addRun(2.0, 2000000000, 1000000000);
+  EXPECT_TRUE(isa::utils::same(1.5e+09, throughput.getOperationsPerSecond())) << "Value: " << throughput.getOperationsPerSecond();
+  EXPECT_TRUE(isa::utils::same(0.75e+09, throughput.getBytesPerSecond())) << "Value: " << throughput.getBytesPerSecond();
+  EXPECT_TRUE(isa::utils::same(2.0, throughput.getArithmeticIntensity())) << "Value: " << throughput.getArithmeticIntensity();
+  EXPECT_EQ(0, throughput.getTimer().getNrRuns());
+  EXPECT_EQ(2, throughput.getNrRuns());
+  // Zero length intervals, e.g. from a coarse clock, are still accounted
+  throughput.addRun(0.0, 2000000000, 1000000000);
+  EXPECT_EQ(3, throughput.getNrRuns());
+  EXPECT_GT(throughput.getOperationsPerSecond(), 1.5e+09);
+}
+
+TEST(ThroughputTest, Roofline) {
+  isa::utils::MachineModel machine(100.0e+09, 10.0e+09);
+  isa::utils::Throughput memoryBound;
+  isa::utils::Throughput computeBound;
+
+  EXPECT_TRUE(isa::utils::same(10.0, machine.getRidgePoint()));
+  // 1 FLOP/B, the roofline is at 10 GFLOP/s
+  memoryBound.addRun(1.0, 5000000000, 5000000000);
+  EXPECT_TRUE(memoryBound.isMemoryBound(machine));
+  EXPECT_TRUE(isa::utils::same(50.0, memoryBound.getRooflinePercentage(machine))) << "Value: " << memoryBound.getRooflinePercentage(machine);
+  // 100 FLOP/B, the roofline is at 100 GFLOP/s
+  computeBound.addRun(1.0, 25000000000, 250000000);
+  EXPECT_FALSE(computeBound.isMemoryBound(machine));
+  EXPECT_TRUE(isa::utils::same(25.0, computeBound.getRooflinePercentage(machine))) << "Value: " << computeBound.getRooflinePercentage(machine);
+  EXPECT_EQ(std::string("25.00 GFLOP/s +/- 0.00 FLOP/s, 250.00 MB/s +/- 0.00 B/s, 100.00 FLOP/B, 25.0% of roofline (compute bound)"), computeBound.getReport(machine));
+  EXPECT_FALSE(computeBound.isAboveRoofline(machine));
+  // A kernel faster than the model, e.g. vectorized code compared with the scalar peak
+  isa::utils::Throughput aboveModel;
+
+  aboveModel.addRun(1.0, 200000000000, 1000000000);
+  EXPECT_TRUE(aboveModel.isAboveRoofline(machine));
+  EXPECT_EQ(std::string("200.00 GFLOP/s +/- 0.00 FLOP/s, 1.00 GB/s +/- 0.00 B/s, 200.00 FLOP/B, 200.0% of roofline (compute bound, above the machine model)"), aboveModel.getReport(machine));
+}
+
+TEST(ThroughputTest, TimedIntervals) {
+  isa::utils::Throughput throughput(1000, 8000);
+
+  for ( unsigned int run = 0; run < 3; run++ ) {
+    throughput.start();
+    throughput.stop();
+  }
+  EXPECT_EQ(3, throughput.getTimer().getNrRuns());
+  EXPECT_EQ(throughput.getTimer().getNrRuns(), throughput.getNrRuns());
+  EXPECT_TRUE(isa::utils::same(0.125, throughput.getArithmeticIntensity()));
+  throughput.reset();
+  EXPECT_EQ(0, throughput.getTimer().getNrRuns());
+  EXPECT_TRUE(isa::utils::same(0.0, throughput.getArithmeticIntensity()));
+}
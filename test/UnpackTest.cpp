@@ -0,0 +1,145 @@
+// Copyright 2026 Alessio Sclocco <alessio@sclocco.eu>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Unpack.hpp>
+#include <utils.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+#include <limits>
+
+namespace {
+
+// Reference implementation, one bit at a time
+template<unsigned int Bits> int referenceSample(const std::vector<std::uint8_t> & packed, const std::size_t sample, const bool isSigned) {
+  int field = 0;
+
+  for ( unsigned int bit = 0; bit < Bits; bit++ ) {
+    field |= isa::utils::getBit(packed.at(((sample * Bits) + bit) / 8), ((sample * Bits) + bit) % 8) << bit;
+  }
+  if ( isSigned && field >= (1 << (Bits - 1)) ) {
+    field -= (1 << Bits);
+  }
+
+  return field;
+}
+
+std::vector<std::uint8_t> randomBytes(const std::size_t nrBytes) {
+  std::vector<std::uint8_t> bytes(nrBytes);
+
+  for ( std::size_t byte = 0; byte < nrBytes; byte++ ) {
+    bytes.at(byte) = static_cast<std::uint8_t>(((byte + 1) * 2654435761u) >> 13);
+  }
+
+  return bytes;
+}
+
+template<unsigned int Bits> void testUnpack() {
+  // Odd sizes exercise the scalar tail after the vector kernels
+  for ( std::size_t nrSamples : {0, 1, 7, 127, 128, 129, 1000, 4099} ) {
+    std::vector<std::uint8_t> packed = randomBytes(((nrSamples * Bits) + 7) / 8);
+
+    for ( bool isSigned : {true, false} ) {
+      std::vector<std::int8_t> bytes(nrSamples);
+      std::vector<std::int16_t> words(nrSamples);
+      std::vector<float> values(nrSamples);
+
+      isa::utils::unpack<Bits>(packed.data(), bytes.data(), nrSamples, isSigned);
+      isa::utils::unpack<Bits>(packed.data(), words.data(), nrSamples, isSigned);
+      isa::utils::unpack<Bits>(packed.data(), values.data(), nrSamples, isSigned, 0.5f, 3.0f);
+      for ( std::size_t sample = 0; sample < nrSamples; sample++ ) {
+        int expected = referenceSample<Bits>(packed, sample, isSigned);
+
+        ASSERT_EQ(static_cast<std::int8_t>(expected), bytes.at(sample)) << "Bits: " << Bits << " sample: " << sample;
+        ASSERT_EQ(expected, words.at(sample)) << "Bits: " << Bits << " sample: " << sample;
+        ASSERT_FLOAT_EQ((expected * 0.5f) + 3.0f, values.at(sample)) << "Bits: " << Bits << " sample: " << sample;
+      }
+    }
+  }
+}
+
+template<unsigned int Bits> void testPack() {
+  for ( std::size_t nrSamples : {1, 9, 64, 100, 1031, 4096} ) {
+    std::vector<std::uint8_t> packed = randomBytes(((nrSamples * Bits) + 7) / 8);
+    std::vector<std::int8_t> samples(nrSamples);
+    std::vector<std::uint8_t> repacked(packed.size(), 0xff);
+
+    // Clear the unused bits of the last byte, that pack() sets to zero
+    if ( (nrSamples * Bits) % 8 != 0 ) {
+      packed.back() &= static_cast<std::uint8_t>((1u << ((nrSamples * Bits) % 8)) - 1);
+    }
+    isa::utils::unpack<Bits>(packed.data(), samples.data(), nrSamples);
+    isa::utils::pack<Bits>(samples.data(), repacked.data(), nrSamples);
+    ASSERT_EQ(packed, repacked) << "Bits: " << Bits << " samples: " << nrSamples;
+  }
+}
+
+} // (anonymous)
+
+TEST(UnpackTest, OneBit) {
+  testUnpack<1>();
+}
+
+TEST(UnpackTest, TwoBits) {
+  testUnpack<2>();
+}
+
+TEST(UnpackTest, FourBits) {
+  testUnpack<4>();
+}
+
+TEST(UnpackTest, EightBits) {
+  testUnpack<8>();
+}
+
+TEST(UnpackTest, Table) {
+  const float levels[4] = {-3.3f, -1.0f, 1.0f, 3.3f};
+  isa::utils::UnpackTable<2> table(levels);
+  std::vector<std::uint8_t> packed = randomBytes(65);
+  std::vector<float> values(259);
+
+  isa::utils::unpack<2>(packed.data(), values.data(), values.size(), table);
+  for ( std::size_t sample = 0; sample < values.size(); sample++ ) {
+    ASSERT_EQ(levels[referenceSample<2>(packed, sample, false)], values.at(sample));
+  }
+  isa::utils::UnpackTable<4> linear(true, 2.0f, 1.0f);
+  EXPECT_EQ(-15.0f, linear.getSamples(0x08)[0]);
+  EXPECT_EQ(15.0f, linear.getSamples(0x07)[0]);
+  EXPECT_EQ(1.0f, linear.getSamples(0x07)[1]);
+}
+
+TEST(PackTest, Integers) {
+  testPack<1>();
+  testPack<2>();
+  testPack<4>();
+  testPack<8>();
+}
+
+TEST(PackTest, Floats) {
+  std::vector<float> values = {-10.0f, -1.1f, -0.4f, 0.0f, 0.6f, 2.0f, 6.9f, 100.0f, 1.0f};
+  std::vector<std::uint8_t> packed(5);
+  std::vector<std::int8_t> samples(values.size());
+
+  isa::utils::pack<4>(values.data(), packed.data(), values.size(), true, 1.0f, 0.0f);
+  isa::utils::unpack<4>(packed.data(), samples.data(), samples.size());
+  EXPECT_EQ(std::vector<std::int8_t>({-8, -1, 0, 0, 1, 2, 7, 7, 1}), samples);
+  isa::utils::pack<2>(values.data(), packed.data(), values.size(), false, 2.0f, -1.0f);
+  isa::utils::unpack<2>(packed.data(), samples.data(), samples.size(), false);
+  EXPECT_EQ(std::vector<std::int8_t>({0, 0, 0, 0, 1, 2, 3, 3, 1}), samples);
+  // NaN is packed as zero
+  values.assign({std::numeric_limits<float>::quiet_NaN(), 3.0f});
+  isa::utils::pack<4>(values.data(), packed.data(), values.size(), true, 1.0f, 0.0f);
+  isa::utils::unpack<4>(packed.data(), samples.data(), values.size());
+  EXPECT_EQ(0, samples.at(0));
+  EXPECT_EQ(3, samples.at(1));
+}
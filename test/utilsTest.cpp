@@ -31,6 +31,16 @@ TEST(ReplaceTest, EraseString) {
   EXPECT_EQ(std::string(""), *(isa::utils::replace(new std::string("Hello World!"), "Hello World!", "", true)));
 }
 
+TEST(ReplaceTest, OutputIsInput) {
+  std::string text("Hello <%NAME%>, <%NAME%>!");
+  std::string name("<%NAME%>");
+
+  isa::utils::replace(text, "<%NAME%>", "World", text);
+  EXPECT_EQ(std::string("Hello World, World!"), text);
+  isa::utils::replace("Hello <%NAME%>!", name, name + name, name);
+  EXPECT_EQ(std::string("Hello <%NAME%><%NAME%>!"), name);
+}
+
 TEST(SameTest, SameValue) {
   float singlePrecision = 932.728292f;
   double doublePrecision = 932.728636126;
@@ -104,6 +114,16 @@ TEST(PadTest, NumberIsNotPadded) {
   EXPECT_EQ(28, isa::utils::pad(28, 7));
 }
 
+TEST(PadTest, CompileTimePadding) {
+  static_assert(isa::utils::pad<16>(17) == 32, "Power of two padding");
+  static_assert(isa::utils::pad<5>(7) == 10, "General padding");
+  EXPECT_EQ(83, isa::utils::pad<83>(12));
+  EXPECT_EQ(92, isa::utils::pad<4>(92));
+  EXPECT_EQ(0, isa::utils::pad<64>(0));
+  EXPECT_EQ(isa::utils::pad(1000001, 7), isa::utils::pad<7>(1000001));
+  EXPECT_EQ(isa::utils::pad(1000001, 64), isa::utils::pad<64>(1000001));
+}
+
 TEST(TeraTest, TeraConversion) {
   EXPECT_TRUE(isa::utils::same(123.456789123, isa::utils::tera(123456789123456), 1.0e-09)) << "Values: " << 123.456789123 << " " << isa::utils::tera(123456789123456);
   EXPECT_TRUE(isa::utils::same(0.123456789, isa::utils::tera(123456789123), 1.0e-09)) << "Values: " << 0.123456789 << " " << isa::utils::tera(123456789123);
@@ -131,3 +151,17 @@ TEST(KiloTest, KiloConversion) {
   EXPECT_TRUE(isa::utils::same(123.456, isa::utils::kilo(123456), 1.0e-03)) << "Values: " << 123.456 << " " << isa::utils::kilo(123456);
   EXPECT_TRUE(isa::utils::same(0.123, isa::utils::kilo(123), 1.0e-03)) << "Values: " << 0.123 << " " << isa::utils::kilo(123);
 }
+
+TEST(FormatTest, DecimalPrefixes) {
+  EXPECT_EQ(std::string("12.35 GFLOP/s"), isa::utils::formatSI(12345678901.0, "FLOP/s"));
+  EXPECT_EQ(std::string("1.5 TB/s"), isa::utils::formatSI(1.5e+12, "B/s", 1));
+  EXPECT_EQ(std::string("999.00 OP/s"), isa::utils::formatSI(999.0, "OP/s"));
+  EXPECT_EQ(std::string("-2.00 kB"), isa::utils::formatSI(-2000.0, "B"));
+}
+
+TEST(FormatTest, BinaryPrefixes) {
+  EXPECT_EQ(std::string("1.50 GiB/s"), isa::utils::formatIEC(1610612736.0, "B/s"));
+  EXPECT_EQ(std::string("4.00 MiB"), isa::utils::formatIEC(4194304.0, "B"));
+  EXPECT_EQ(std::string("1.00 KiB"), isa::utils::formatIEC(1024.0, "B"));
+  EXPECT_EQ(std::string("512.00 B"), isa::utils::formatIEC(512.0, "B"));
+}